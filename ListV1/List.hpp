@@ -1,9 +1,10 @@
 #ifndef HPP_PRELUDE_LIST
 #define HPP_PRELUDE_LIST
 
-#include <memory>
 #include <functional>
 
+#include "../ListV10/Pool.hpp"
+
 /**
  * Implementation of Haskell-like, functional programming idioms, particularly recursive Lists.
  */
@@ -25,9 +26,9 @@ class List
    * Internal node structure for a list.
    * @note required so that List can provide a distinct empty-list value
    */
-  struct Node
+  struct Node : public _counted
   {
-    using Ptr = std::shared_ptr<Node>;
+    using Ptr = shared_node<Node>;
 
     /**
      * Make an internal list node from an element and a pointer to a node.
@@ -44,6 +45,18 @@ class List
      */
     Node( T x, Ptr && xs ) : _datum( x ), _tail( std::forward<Ptr>( xs ) ) {}
 
+    /**
+     * Unlinks solely-owned successors one at a time, so that dropping a long list
+     * does not recurse once per element through the tail's destructor.
+     */
+    ~Node()
+    {
+      while ( _tail && _tail.use_count() == 1 ) {
+        auto next = std::move( _tail->_tail );
+        _tail = std::move( next );
+      }
+    }
+
     /** The value of an element. */
     T _datum;
 
@@ -62,7 +75,7 @@ public:
    * @note this constructor will never be called implicitly
    */
   explicit List( T const& x, List const& xs = EMPTY )
-    : _head( std::make_shared<Node>( x, xs._head ) ) {}
+    : _head( make_shared_node<Node>( x, xs._head ) ) {}
 
   /**
    * Make a list by prepending an element to an existing list.
@@ -71,14 +84,14 @@ public:
    * @note this constructor will never be called implicitly
    */
   explicit List( T const& x, List && xs )
-    : _head( std::make_shared<Node>( x, std::move( xs._head ) ) ) {}
+    : _head( make_shared_node<Node>( x, std::move( xs._head ) ) ) {}
 
   /**
    * Make a list using standard universal initializer.
    */
   List( std::initializer_list<T> xs ) {
     for (auto i = xs.end(); i-- != xs.begin();) {
-      _head = std::make_shared<Node>(*i, _head);
+      _head = make_shared_node<Node>(*i, _head);
     }
   }
 
@@ -127,10 +140,10 @@ public:
 
 private:
     // pointer to internal node represenation
-    std::shared_ptr<Node> _head;
+    shared_node<Node> _head;
 
     // Permits implicit construction from pointer-to-Node (used internally & by friends)
-    List( std::shared_ptr<Node> xs = nullptr ) : _head( xs ) {}
+    List( shared_node<Node> xs = nullptr ) : _head( xs ) {}
 
     // Various friends allow for non-OOP functional-style
 
@@ -0,0 +1,245 @@
+#ifndef HPP_PRELUDE_ATOMIC_LIST
+#define HPP_PRELUDE_ATOMIC_LIST
+
+// The macro changes the layout of list nodes, so it must be defined for every translation
+// unit of the program (e.g. -DPRELUDE_LIST_ATOMIC_REFS), never by this header alone.
+#ifndef PRELUDE_LIST_ATOMIC_REFS
+#error "AtomicList.hpp requires PRELUDE_LIST_ATOMIC_REFS to be defined for the whole program"
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "List.hpp"
+#include "Maybe.hpp"
+
+/**
+ * Implementation of Haskell-like, functional programming idioms, particularly recursive lists.
+ */
+namespace prelude {
+
+/**
+ * Process-wide hazard pointer registry. For internal use only.
+ * Each thread owns one slot, in which it publishes the node it is about to dereference.
+ * A retired node is only released once no slot refers to it, so a node read from an
+ * {@code atomic_list} cannot be freed (and its address reused) while a thread holds it;
+ * this is what prevents ABA on the compare-and-swap of the top pointer.
+ */
+class _hazard_domain
+{
+public:
+    /** Maximum number of threads that may use atomic lists concurrently. */
+    static constexpr std::size_t SLOTS = 256;
+    /** Number of retired nodes a thread accumulates before scanning the slots. */
+    static constexpr std::size_t SCAN_THRESHOLD = 2 * SLOTS;
+
+    using retired = std::pair<void*, void (*)( void* )>;
+
+    static _hazard_domain& instance() { static _hazard_domain d; return d; }
+
+    /** Hazard slot of the calling thread. */
+    static std::atomic<void const*>& slot() { return local()._slot; }
+
+    /**
+     * Defers a release until no thread has published {@code p} as hazardous.
+     * @param p a retired pointer
+     * @param reclaim function that releases {@code p}
+     */
+    static void retire( void* p, void (*reclaim)( void* ) )
+    {
+        auto& rec = local();
+        rec._retired.emplace_back( p, reclaim );
+        if ( rec._retired.size() >= SCAN_THRESHOLD ) { instance().scan( rec._retired ); }
+    }
+
+private:
+    _hazard_domain() : _slots(), _owned() {}
+
+    struct record
+    {
+        record() : _slot( instance().claim() ) {}
+        ~record()
+        {
+            auto& d = instance();
+            _slot.store( nullptr );
+            d.scan( _retired );
+            if ( !_retired.empty() ) {
+                std::lock_guard<std::mutex> lock( d._orphans_lock );
+                d._orphans.insert( d._orphans.end(), _retired.begin(), _retired.end() );
+            }
+            d._owned[&_slot - d._slots].store( false );
+        }
+        std::atomic<void const*>& _slot;
+        std::vector<retired>      _retired;
+    };
+
+    static record& local() { thread_local record rec; return rec; }
+
+    std::atomic<void const*>& claim()
+    {
+        for ( std::size_t i = 0; i < SLOTS; ++i ) {
+            bool expected = false;
+            if ( _owned[i].compare_exchange_strong( expected, true ) ) { return _slots[i]; }
+        }
+        throw std::runtime_error("prelude::atomic_list: too many threads");
+    }
+
+    /** Releases every retired pointer (including orphans of exited threads) not currently hazardous. */
+    void scan( std::vector<retired>& rs )
+    {
+        {
+            std::lock_guard<std::mutex> lock( _orphans_lock );
+            rs.insert( rs.end(), _orphans.begin(), _orphans.end() );
+            _orphans.clear();
+        }
+        std::vector<void const*> hazards;
+        for ( auto& s : _slots ) {
+            if ( auto p = s.load() ) { hazards.push_back( p ); }
+        }
+        std::sort( hazards.begin(), hazards.end() );
+
+        std::vector<retired> kept;
+        for ( auto& r : rs ) {
+            if ( std::binary_search( hazards.begin(), hazards.end(), r.first ) ) {
+                kept.push_back( r );
+            } else {
+                r.second( r.first );
+            }
+        }
+        rs.swap( kept );
+    }
+
+    std::atomic<void const*> _slots[SLOTS];
+    std::atomic<bool>        _owned[SLOTS];
+    std::mutex               _orphans_lock;
+    std::vector<retired>     _orphans;
+};
+
+/**
+ * Mutable, thread-safe handle to an immutable list: a lock-free (Treiber) stack whose
+ * states are ordinary {@code list} values. {@code push} conses onto the current list and
+ * {@code pop} replaces it with its tail, each by a single compare-and-swap of the top node;
+ * {@code snapshot} returns the current list, which stays valid however the handle changes.
+ * Node reference counts are atomic (PRELUDE_LIST_ATOMIC_REFS) and the handle's own claim on a
+ * replaced top node is released through hazard pointers.
+ *
+ * @author Matthew A Johnson
+ * @version 1.0
+ */
+template <typename A>
+class atomic_list
+{
+    using node = typename list<A>::node;
+public:
+    /**
+     * Constructs a handle whose initial state is the empty list.
+     */
+    atomic_list() : _top( nullptr ) {}
+    /**
+     * Constructs a handle whose initial state is the specified list.
+     * @param xs the initial list
+     */
+    explicit atomic_list( list<A> xs ) : _top( xs._rep ) { xs._rep = nullptr; }
+    atomic_list( atomic_list const& ) = delete;
+    atomic_list& operator= ( atomic_list const& ) = delete;
+    /**
+     * Destroys this handle. Must not race with any other operation on it.
+     */
+    ~atomic_list() { list<A>::release( _top.load() ); }
+
+    /**
+     * Pre-pends an element to the current list.
+     * @param x an element
+     */
+    void push( A x )
+    {
+        auto n = list<A>::acquire( new node( std::move( x ) ) );
+        auto p = protect();
+        do {
+            n->_tail = p;   // takes over the handle's claim on p if the swap succeeds
+            list<A>::seal( n, n );
+        } while ( !_top.compare_exchange_weak( p, n ) && ( p = protect(), true ) );
+        unprotect();
+    }
+
+    /**
+     * Removes the first element of the current list.
+     * @return the removed element, or nothing if the list was empty
+     */
+    maybe<A> pop()
+    {
+        auto p = protect();
+        for ( ;; ) {
+            if ( !p ) { unprotect(); return nothing<A>(); }
+            // The handle's claim on the new top, taken while the protected p keeps it alive.
+            auto next = list<A>::acquire( p->_tail );
+            if ( _top.compare_exchange_weak( p, next ) ) { break; }
+            list<A>::release( next );
+            p = protect();
+        }
+        A x = p->_head;
+        unprotect();
+        retire( p );
+        return just( x );
+    }
+
+    /**
+     * Gets the current list. The result is an ordinary immutable list that shares
+     * structure with this handle.
+     * @return the current state of this handle
+     */
+    list<A> snapshot() const
+    {
+        auto xs = list<A>( protect() );
+        unprotect();
+        return xs;
+    }
+
+    /**
+     * Replaces the current list with {@code desired} if it is (physically) {@code expected};
+     * otherwise loads the current list into {@code expected}.
+     * @param expected the list assumed to be current
+     * @param desired the replacement list
+     * @return true if the replacement was made
+     */
+    bool compare_exchange( list<A>& expected, list<A> desired )
+    {
+        auto p = expected._rep;
+        if ( _top.compare_exchange_strong( p, desired._rep ) ) {
+            desired._rep = nullptr;
+            if ( p ) { retire( p ); }
+            return true;
+        }
+        expected = snapshot();
+        return false;
+    }
+
+private:
+    std::atomic<node*> _top;
+
+    /** Loads the top node and publishes it as hazardous, so it cannot be reclaimed. */
+    node* protect() const
+    {
+        auto& hazard = _hazard_domain::slot();
+        node* p;
+        do {
+            p = _top.load();
+            hazard.store( p );
+        } while ( p != _top.load() );
+        return p;
+    }
+    static void unprotect() { _hazard_domain::slot().store( nullptr ); }
+
+    /** Defers releasing the handle's claim on a node until no thread has it protected. */
+    static void retire( node* p )
+        { _hazard_domain::retire( p, []( void* n ){ list<A>::release( static_cast<node*>( n ) ); } ); }
+};
+
+} // end namespace prelude
+
+#endif //HPP_PRELUDE_ATOMIC_LIST
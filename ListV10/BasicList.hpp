@@ -0,0 +1,514 @@
+#ifndef HPP_PRELUDE_BASIC_LIST
+#define HPP_PRELUDE_BASIC_LIST
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <ostream>
+#include <stdexcept>
+#include <utility>
+
+#include "Pool.hpp"
+
+/**
+ * Implementation of Haskell-like, functional programming idioms, particularly recursive lists.
+ */
+namespace prelude {
+
+// Allocation policies
+
+/**
+ * Allocation policy using the global {@code new} and {@code delete} (std::allocator).
+ */
+struct new_alloc
+{
+    template <typename T> using allocator = std::allocator<T>;
+
+    template <typename T, typename... Args>
+    static T* create( Args&&... args ) { return new T( std::forward<Args>( args )... ); }
+    template <typename T>
+    static void destroy( T* p ) { delete p; }
+};
+
+/**
+ * Allocation policy drawing single objects from per-thread pools of fixed-size blocks,
+ * which avoids a general-purpose heap allocation per list node.
+ */
+struct pool_alloc
+{
+    /** Standard allocator over the pools, for use with std::allocate_shared. */
+    template <typename T>
+    struct allocator
+    {
+        using value_type = T;
+
+        allocator() = default;
+        template <typename U> allocator( allocator<U> const& ) {}
+
+        T* allocate( std::size_t n )
+        {
+            if ( n == 1 ) { return static_cast<T*>( _block_pool<sizeof( T ), alignof( T )>::allocate() ); }
+            return static_cast<T*>( ::operator new( n * sizeof( T ) ) );
+        }
+        void deallocate( T* p, std::size_t n )
+        {
+            if ( n == 1 ) { _block_pool<sizeof( T ), alignof( T )>::deallocate( p ); } else { ::operator delete( p ); }
+        }
+
+        template <typename U> bool operator== ( allocator<U> const& ) const { return true; }
+        template <typename U> bool operator!= ( allocator<U> const& ) const { return false; }
+    };
+
+    template <typename T, typename... Args>
+    static T* create( Args&&... args )
+    {
+        auto p = _block_pool<sizeof( T ), alignof( T )>::allocate();
+        try {
+            return new ( p ) T( std::forward<Args>( args )... );
+        } catch ( ... ) {
+            _block_pool<sizeof( T ), alignof( T )>::deallocate( p );
+            throw;
+        }
+    }
+    template <typename T>
+    static void destroy( T* p )
+    {
+        p->~T();
+        _block_pool<sizeof( T ), alignof( T )>::deallocate( p );
+    }
+};
+
+// Ownership policies
+
+/**
+ * Ownership policy in which each list exclusively owns its nodes (as in ListV0): copying a
+ * list, or taking a tail or suffix of one, copies the nodes concerned.
+ */
+struct unique_ownership
+{
+    template <typename A, typename Alloc>
+    struct rep
+    {
+        struct node
+        {
+            node( A x ) : _head( std::move( x ) ), _tail( nullptr ) {}
+            A const _head;
+            node*   _tail;
+        };
+        using pointer = node*;
+
+        static pointer make( A x ) { return Alloc::template create<node>( std::move( x ) ); }
+        static node* get( pointer const& p ) { return p; }
+        static pointer share( pointer const& p )
+        {
+            pointer first = nullptr;
+            auto to = &first;
+            for ( node const* n = p; n; n = n->_tail ) { *to = make( n->_head ); to = &(*to)->_tail; }
+            return first;
+        }
+        static void release( pointer& p )
+        {
+            while ( p ) { auto next = p->_tail; Alloc::destroy( p ); p = next; }
+        }
+    };
+};
+
+/**
+ * Ownership policy sharing nodes through {@code std::shared_ptr}, as ListV1, ListV5 and ListV7
+ * did before they moved to Pool.hpp's {@code shared_node}.
+ * Nodes are made with {@code std::allocate_shared}, so each node and its control block
+ * are a single allocation from the allocation policy.
+ */
+struct shared_ownership
+{
+    template <typename A, typename Alloc>
+    struct rep
+    {
+        struct node
+        {
+            node( A x ) : _head( std::move( x ) ), _tail() {}
+            A const               _head;
+            std::shared_ptr<node> _tail;
+        };
+        using pointer = std::shared_ptr<node>;
+
+        static pointer make( A x )
+            { return std::allocate_shared<node>( typename Alloc::template allocator<node>(), std::move( x ) ); }
+        static node* get( pointer const& p ) { return p.get(); }
+        static pointer share( pointer const& p ) { return p; }
+        /** Unlinks solely-owned nodes one at a time, so a long list is not destroyed recursively. */
+        static void release( pointer& p )
+        {
+            while ( p && p.use_count() == 1 ) { auto next = std::move( p->_tail ); p = std::move( next ); }
+            p.reset();
+        }
+    };
+};
+
+/**
+ * Ownership policy counting references inside each node (as in ListV9 and ListV10, and in
+ * ListV1, ListV5 and ListV7 through {@code shared_node}). With {@code new_alloc} the list is
+ * ListV10's own {@code list}, so the {@code rep} below serves the other allocation policies.
+ */
+struct intrusive_ownership
+{
+    template <typename A, typename Alloc>
+    struct rep
+    {
+        struct node
+        {
+            node( A x ) : _refs( 1 ), _head( std::move( x ) ), _tail( nullptr ) {}
+            size_t  _refs;
+            A const _head;
+            node*   _tail;
+        };
+        using pointer = node*;
+
+        static pointer make( A x ) { return Alloc::template create<node>( std::move( x ) ); }
+        static node* get( pointer const& p ) { return p; }
+        static pointer share( pointer const& p ) { if ( p ) { ++(p->_refs); } return p; }
+        static void release( pointer& p )
+        {
+            while ( p && !--(p->_refs) ) { auto next = p->_tail; Alloc::destroy( p ); p = next; }
+            p = nullptr;
+        }
+    };
+};
+
+/**
+ * Family of immutable, recursively-defined, homogeneous list types whose node ownership
+ * and node allocation are chosen by policy. Every list operation is written once, against
+ * the policy's {@code rep}: a {@code node} with {@code _head} and {@code _tail} members, an
+ * owning {@code pointer} to nodes, and the functions {@code make} (a node with no tail),
+ * {@code get} (pointer to node), {@code share} (a further owning pointer to the same
+ * elements) and {@code release}. Lists of different policies are distinct types.
+ * The default policies, {@code intrusive_ownership} and {@code new_alloc}, give {@code list},
+ * which List.hpp defines as a specialization with its own, fuller set of operations.
+ *
+ * @author Matthew A Johnson
+ * @version 1.0
+ */
+template <typename A, typename OwnershipPolicy = intrusive_ownership, typename AllocPolicy = new_alloc>
+class basic_list
+{
+    using rep = typename OwnershipPolicy::template rep<A, AllocPolicy>;
+    using node = typename rep::node;
+    using pointer = typename rep::pointer;
+public:
+    /**
+     * Constructs the empty list.
+     */
+    basic_list() : _rep() {}
+    /**
+     * Constructs a singleton list containing the specified element.
+     * @param x the element to be stored in this list
+     */
+    basic_list( A x ) : _rep( rep::make( std::move( x ) ) ) {}
+    /**
+     * Constructs a finite list using standard uniform initialization.
+     * @param xs a comma-separated list of values that will be elements of this list
+     */
+    basic_list( std::initializer_list<A> xs ) : _rep()
+        {
+            auto to = &_rep;
+            for ( auto const& x : xs ) { to = snoc( to, x ); }
+        }
+    /**
+     * Copies the specified list, sharing its nodes unless the ownership policy forbids it.
+     * @param xs the existing list to be copied
+     */
+    basic_list( basic_list const& xs ) : _rep( rep::share( xs._rep ) ) {}
+    basic_list( basic_list && xs ) noexcept : _rep( std::move( xs._rep ) ) { xs._rep = pointer(); }
+    /**
+     * Destroys this list and any referenced nodes for which this list was sole owner.
+     */
+    ~basic_list() { rep::release( _rep ); }
+
+    basic_list& operator= ( basic_list const& xs )
+        { if ( this != &xs ) { auto p = rep::share( xs._rep ); rep::release( _rep ); _rep = std::move( p ); } return *this; }
+    basic_list& operator= ( basic_list && xs ) noexcept
+        { std::swap( _rep, xs._rep ); return *this; }
+
+    /**
+     * Casting operator permits type-conversion from list to boolean for use in test expressions.
+     */
+    explicit operator bool() const { return rep::get( _rep ) != nullptr; }
+
+private:
+    pointer _rep;
+
+    /** Auxiliary function for the first node of a list, or nullptr if it is empty. */
+    static node* first( basic_list const& xs ) { return rep::get( xs._rep ); }
+    /**
+     * Auxiliary function for building lists front to back: stores a new node holding {@code x}
+     * at {@code to} (the first pointer or the tail of the last node) and returns where the next one goes.
+     */
+    static pointer* snoc( pointer* to, A x ) { *to = rep::make( std::move( x ) ); return &rep::get( *to )->_tail; }
+
+    /** `Cons`-constructor, for internal use only. */
+    basic_list( A x, basic_list && xs ) : _rep( rep::make( std::move( x ) ) )
+        { rep::get( _rep )->_tail = std::move( xs._rep ); xs._rep = pointer(); }
+
+    template <typename B, typename O, typename L> friend basic_list<B, O, L> operator| ( B, basic_list<B, O, L> );
+    template <typename B, typename O, typename L> friend B const& head( basic_list<B, O, L> const& );
+    template <typename B, typename O, typename L> friend basic_list<B, O, L> tail( basic_list<B, O, L> const& );
+    template <typename B, typename O, typename L> friend size_t length( basic_list<B, O, L> const& );
+    template <typename F, typename B, typename O, typename L> friend auto map( F f, basic_list<B, O, L> const& xs )
+        -> basic_list<decltype( f( head( xs ) ) ), O, L>;
+    template <typename P, typename B, typename O, typename L> friend basic_list<B, O, L> filter( P, basic_list<B, O, L> const& );
+    template <typename F, typename Z, typename B, typename O, typename L> friend Z foldl( F, Z, basic_list<B, O, L> const& );
+    template <typename B, typename O, typename L> friend basic_list<B, O, L> reverse( basic_list<B, O, L> const& );
+    template <typename B, typename O, typename L> friend basic_list<B, O, L> operator+ ( basic_list<B, O, L> const&, basic_list<B, O, L> const& );
+    template <typename B, typename O, typename L> friend basic_list<B, O, L> take( unsigned, basic_list<B, O, L> const& );
+    template <typename B, typename O, typename L> friend basic_list<B, O, L> drop( unsigned, basic_list<B, O, L> const& );
+    template <typename B, typename O, typename L> friend bool operator== ( basic_list<B, O, L> const&, basic_list<B, O, L> const& );
+    template <typename B, typename O, typename L> friend std::ostream& operator<< ( std::ostream&, basic_list<B, O, L> const& );
+};
+
+/**
+ * The list type, {@code list<A>}: defined in List.hpp, which includes this header.
+ */
+template <typename A> class basic_list<A, intrusive_ownership, new_alloc>;
+
+/**
+ * Constructs a list by pre-pending an element to an existing list.
+ * @param x an element
+ * @param xs a list
+ * @return a list with {@code x} at the head and {@code xs} as the tail
+ */
+template <typename A, typename O, typename L>
+inline basic_list<A, O, L> operator| ( A x, basic_list<A, O, L> xs ) { return basic_list<A, O, L>( std::move( x ), std::move( xs ) ); }
+
+/**
+ * Constructs a list by pre-pending an element to an existing list.
+ * @param x an element
+ * @param xs a list
+ * @return a list with {@code x} at the head and {@code xs} as the tail
+ */
+template <typename A, typename O, typename L>
+inline basic_list<A, O, L> cons( A x, basic_list<A, O, L> xs ) { return std::move( x ) | std::move( xs ); }
+
+/**
+ * Test whether a list is empty.
+ * @param xs a list
+ * @return true if {@code xs} is empty, false otherwise
+ */
+template <typename A, typename O, typename L>
+inline bool null( basic_list<A, O, L> const& xs ) { return !xs; }
+
+/**
+ * Extract the first element of a list, which must be non-empty.
+ * @param xs a non-empty list
+ * @return the first element of {@code xs}
+ * @throws std::domain_error if {@code xs} is empty
+ */
+template <typename A, typename O, typename L>
+inline A const& head( basic_list<A, O, L> const& xs )
+{
+    if ( null( xs ) ) { throw std::domain_error("prelude::head: empty list"); }
+    return basic_list<A, O, L>::first( xs )->_head;
+}
+
+/**
+ * Extract the elements after the head of a list, which must be non-empty.
+ * @param xs a non-empty list
+ * @return a list containing all but the first element of {@code xs}
+ * @throws std::domain_error if {@code xs} is empty
+ */
+template <typename A, typename O, typename L>
+inline basic_list<A, O, L> tail( basic_list<A, O, L> const& xs )
+{
+    using rep = typename O::template rep<A, L>;
+
+    if ( null( xs ) ) { throw std::domain_error("prelude::tail: empty list"); }
+    basic_list<A, O, L> ys;
+    ys._rep = rep::share( basic_list<A, O, L>::first( xs )->_tail );
+    return ys;
+}
+
+/**
+ * Returns the length of a finite list.
+ * @param xs a list
+ * @return the number of elements in {@code xs}
+ */
+template <typename A, typename O, typename L>
+inline size_t length( basic_list<A, O, L> const& xs )
+{
+    using rep = typename O::template rep<A, L>;
+
+    size_t k = 0;
+    for ( auto e = basic_list<A, O, L>::first( xs ); e; e = rep::get( e->_tail ) ) { ++k; }
+    return k;
+}
+
+/**
+ * {@code map(f, xs)} is the list obtained by applying {@code f} to each element of {@code xs}.
+ * @param f function that takes an element of {@code xs} and returns a different type
+ * @param xs a list
+ * @return a list of elements the same type as the return type of {@code f}
+ */
+template <typename F, typename A, typename O, typename L>
+inline auto map( F f, basic_list<A, O, L> const& xs ) -> basic_list<decltype( f( head( xs ) ) ), O, L>
+{
+    using B = decltype( f( head( xs ) ) );
+    using rep = typename O::template rep<A, L>;
+
+    basic_list<B, O, L> ys;
+    auto to = &ys._rep;
+    for ( auto e = basic_list<A, O, L>::first( xs ); e; e = rep::get( e->_tail ) ) {
+        to = basic_list<B, O, L>::snoc( to, f( e->_head ) );
+    }
+    return ys;
+}
+
+/**
+ * {@code filter}, applied to a predicate and a list, returns the list of
+ * those elements that satisfy the predicate.
+ * @param pred a predicate function
+ * @param xs a list
+ * @return a list containing those elements of {@code xs} satisfying {@code pred}
+ */
+template <typename P, typename A, typename O, typename L>
+inline basic_list<A, O, L> filter( P pred, basic_list<A, O, L> const& xs )
+{
+    using rep = typename O::template rep<A, L>;
+
+    basic_list<A, O, L> ys;
+    auto to = &ys._rep;
+    for ( auto e = basic_list<A, O, L>::first( xs ); e; e = rep::get( e->_tail ) ) {
+        if ( pred( e->_head ) ) { to = basic_list<A, O, L>::snoc( to, e->_head ); }
+    }
+    return ys;
+}
+
+/**
+ * Left-associative fold of a list.
+ * @param f a binary operator taking the accumulator then an element
+ * @param z the starting value of the accumulator
+ * @param xs a finite list
+ * @return the final value of the accumulator
+ */
+template <typename F, typename B, typename A, typename O, typename L>
+inline B foldl( F f, B z, basic_list<A, O, L> const& xs )
+{
+    using rep = typename O::template rep<A, L>;
+
+    for ( auto e = basic_list<A, O, L>::first( xs ); e; e = rep::get( e->_tail ) ) {
+        z = f( std::move( z ), e->_head );
+    }
+    return z;
+}
+
+/**
+ * The {@code sum} function computes the sum of a finite list of numbers.
+ * @param xs a list
+ * @return the sum of each element of {@code xs}
+ */
+template <typename A, typename O, typename L>
+inline A sum( basic_list<A, O, L> const& xs ) { return foldl( []( A acc, A const& x ){ return acc += x; }, A( 0 ), xs ); }
+
+/**
+ * Reverses a finite list.
+ * @param xs a finite list
+ * @return a list whose elements are the same as {@code xs} but in reverse order
+ */
+template <typename A, typename O, typename L>
+inline basic_list<A, O, L> reverse( basic_list<A, O, L> const& xs )
+{
+    using rep = typename O::template rep<A, L>;
+
+    basic_list<A, O, L> ys;
+    for ( auto e = basic_list<A, O, L>::first( xs ); e; e = rep::get( e->_tail ) ) {
+        ys = basic_list<A, O, L>( e->_head, std::move( ys ) );
+    }
+    return ys;
+}
+
+/**
+ * Append two lists, i.e.,
+ *     {@code list(x1, ..., xm) + list(y1, ..., yn) == list(x1, ..., xm, y1, ..., yn)}
+ * The elements of {@code xs} are copied; {@code ys} is shared unless the ownership policy forbids it.
+ * @param xs a finite list
+ * @param ys a list
+ * @return a list in which the elements of {@code xs} precede the elements of {@code ys}
+ */
+template <typename A, typename O, typename L>
+inline basic_list<A, O, L> operator+ ( basic_list<A, O, L> const& xs, basic_list<A, O, L> const& ys )
+{
+    using rep = typename O::template rep<A, L>;
+
+    basic_list<A, O, L> zs;
+    auto to = &zs._rep;
+    for ( auto e = basic_list<A, O, L>::first( xs ); e; e = rep::get( e->_tail ) ) {
+        to = basic_list<A, O, L>::snoc( to, e->_head );
+    }
+    *to = rep::share( ys._rep );
+    return zs;
+}
+
+/**
+ * Gets from a list its leading sublist of a given size if one exists.
+ * @param k a non-negative integer
+ * @param xs a list
+ * @return a sublist of {@code xs} with at most {@code k} elements
+ */
+template <typename A, typename O, typename L>
+inline basic_list<A, O, L> take( unsigned k, basic_list<A, O, L> const& xs )
+{
+    using rep = typename O::template rep<A, L>;
+
+    basic_list<A, O, L> ys;
+    auto to = &ys._rep;
+    for ( auto e = basic_list<A, O, L>::first( xs ); e && k > 0; e = rep::get( e->_tail ), --k ) {
+        to = basic_list<A, O, L>::snoc( to, e->_head );
+    }
+    return ys;
+}
+
+/**
+ * Gets what remains after removing a given number of elements from a list.
+ * @param k a non-negative integer
+ * @param xs a list
+ * @return the suffix of {@code xs} after its first {@code k} elements
+ */
+template <typename A, typename O, typename L>
+inline basic_list<A, O, L> drop( unsigned k, basic_list<A, O, L> const& xs )
+{
+    using rep = typename O::template rep<A, L>;
+
+    auto from = &xs._rep;
+    for ( ; *from && k > 0; --k ) { from = &rep::get( *from )->_tail; }
+    basic_list<A, O, L> ys;
+    ys._rep = rep::share( *from );
+    return ys;
+}
+
+template <typename A, typename O, typename L>
+inline bool operator== ( basic_list<A, O, L> const& xs, basic_list<A, O, L> const& ys )
+{
+    using rep = typename O::template rep<A, L>;
+
+    auto x = basic_list<A, O, L>::first( xs ), y = basic_list<A, O, L>::first( ys );
+    for ( ; x != y; x = rep::get( x->_tail ), y = rep::get( y->_tail ) ) {
+        if ( !x || !y || !( x->_head == y->_head ) ) { return false; }
+    }
+    return true;
+}
+
+template <typename A, typename O, typename L>
+std::ostream& operator<< ( std::ostream& os, basic_list<A, O, L> const& xs )
+{
+    using rep = typename O::template rep<A, L>;
+
+    os << '[';
+    for ( auto e = basic_list<A, O, L>::first( xs ); e; e = rep::get( e->_tail ) ) {
+        if ( e != basic_list<A, O, L>::first( xs ) ) { os << ','; }
+        os << e->_head;
+    }
+    return os << ']';
+}
+
+} // end namespace prelude
+
+#endif //HPP_PRELUDE_BASIC_LIST
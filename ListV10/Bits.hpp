@@ -0,0 +1,486 @@
+#ifndef HPP_PRELUDE_BITS
+#define HPP_PRELUDE_BITS
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "List.hpp"
+
+/**
+ * Implementation of Haskell-like, functional programming idioms, particularly recursive lists.
+ */
+namespace prelude {
+
+/** Number of set bits in a word. */
+inline unsigned _popcount( std::uint64_t w )
+{
+#if defined( __GNUC__ ) || defined( __clang__ )
+    return static_cast<unsigned>( __builtin_popcountll( w ) );
+#else
+    w = w - ( ( w >> 1 ) & 0x5555555555555555ull );
+    w = ( w & 0x3333333333333333ull ) + ( ( w >> 2 ) & 0x3333333333333333ull );
+    w = ( w + ( w >> 4 ) ) & 0x0f0f0f0f0f0f0f0full;
+    return static_cast<unsigned>( ( w * 0x0101010101010101ull ) >> 56 );
+#endif
+}
+
+/** Index of the lowest set bit of a non-zero word. */
+inline unsigned _ctz( std::uint64_t w )
+{
+#if defined( __GNUC__ ) || defined( __clang__ )
+    return static_cast<unsigned>( __builtin_ctzll( w ) );
+#else
+    unsigned i = 0;
+    for ( ; !( w & 1 ); w >>= 1 ) { ++i; }
+    return i;
+#endif
+}
+
+/** The low {@code k} bits of a word, {@code k <= 64}. */
+inline std::uint64_t _low_bits( std::uint64_t w, unsigned k )
+{
+    return k >= 64 ? w : w & ( ( std::uint64_t( 1 ) << k ) - 1 );
+}
+
+/**
+ * Immutable chunk of up to {@code SIZE} flags, 64 to a word, the first flag in the least
+ * significant bit of the first word. Unused bits of the last word are zero. For internal use only.
+ */
+struct _bit_chunk
+{
+    /** Number of words in a full chunk. */
+    static constexpr unsigned WORDS = 8;
+    /** Number of flags in a full chunk. */
+    static constexpr unsigned SIZE = 64 * WORDS;
+
+    unsigned      _count;
+    std::uint64_t _words[WORDS];
+};
+
+/**
+ * Immutable list of booleans stored as bits, in persistent chunks of {@code _bit_chunk::SIZE}.
+ * It has the same shape as {@code packed}: flags consed onto the front stay in an ordinary
+ * list in front of the chunks, and {@code tail} is an O(1) view that advances a (chunk, offset)
+ * position, so chunks are shared between a bitlist and its suffixes. {@code sum} counts set
+ * bits a word at a time, and {@code &}, {@code |} and {@code zipWith} combine two bitlists
+ * word by word whatever their alignment.
+ *
+ * @author Matthew A Johnson
+ * @version 1.0
+ */
+class bitlist
+{
+public:
+    using chunk = std::shared_ptr<_bit_chunk const>;
+
+private:
+    // Flags consed onto the front, unpacked.
+    list<bool>  _front;
+    // The packed chunks; the first {@code _offset} flags of the first chunk are not part of this list.
+    list<chunk> _chunks;
+    size_t      _offset;
+    size_t      _length;
+
+    bitlist( list<bool> front, list<chunk> chunks, size_t offset, size_t n )
+        : _front( std::move( front ) ), _chunks( std::move( chunks ) ), _offset( offset ), _length( n ) {}
+
+    friend class _bit_reader;
+    friend class _bit_writer;
+    friend bitlist operator| ( bool, bitlist const& );
+    friend size_t length( bitlist const& );
+    friend bool head( bitlist const& );
+    friend bitlist drop( size_t, bitlist const& );
+    friend size_t sum( bitlist const& );
+};
+
+/**
+ * Reads the flags of a bitlist in order, up to a word at a time. For internal use only.
+ */
+class _bit_reader
+{
+    list_ref<bool>            _front;
+    list_ref<bitlist::chunk>  _chunks;
+    size_t                    _pos;
+    size_t                    _left;
+
+public:
+    explicit _bit_reader( bitlist const& xs ) : _front( xs._front ), _chunks( xs._chunks ), _pos( xs._offset ), _left( xs._length ) {}
+
+    /** The number of flags not yet read. */
+    size_t left() const { return _left; }
+
+    /**
+     * Reads the next {@code k} flags, {@code k <= min(64, left())}, into the low bits of a word.
+     * Away from the front, an aligned read is a single word load.
+     */
+    std::uint64_t next( unsigned k )
+    {
+        std::uint64_t w = 0;
+        unsigned got = 0;
+        for ( ; got < k && !null( _front ); ++got, _front = tail( _front ) ) {
+            w |= std::uint64_t( head( _front ) ) << got;
+        }
+        while ( got < k ) {
+            auto const& c = *head( _chunks );
+            auto bit = static_cast<unsigned>( _pos % 64 );
+            auto take = std::min<size_t>( { k - got, c._count - _pos, 64u - bit } );
+            w |= _low_bits( c._words[_pos / 64] >> bit, static_cast<unsigned>( take ) ) << got;
+            got += static_cast<unsigned>( take );
+            if ( ( _pos += take ) == c._count ) { _chunks = tail( _chunks ); _pos = 0; }
+        }
+        _left -= k;
+        return w;
+    }
+};
+
+/**
+ * Appends flags, up to a word at a time, and assembles the chunks into a bitlist.
+ * For internal use only.
+ */
+class _bit_writer
+{
+    std::vector<bitlist::chunk> _done;
+    _bit_chunk                  _cur{};
+    size_t                      _length = 0;
+
+    void flush()
+    {
+        _done.push_back( std::make_shared<_bit_chunk const>( _cur ) );
+        _cur = _bit_chunk{};
+    }
+
+public:
+    /** Appends the low {@code k} bits of {@code w}, {@code k <= 64}, which must be all it has. */
+    void put( std::uint64_t w, unsigned k )
+    {
+        if ( !k ) { return; }
+        auto bit = _cur._count % 64;
+        _cur._words[_cur._count / 64] |= w << bit;
+        auto room = _bit_chunk::SIZE - _cur._count;
+        if ( bit && k > 64 - bit && k <= room ) { _cur._words[_cur._count / 64 + 1] = w >> ( 64 - bit ); }
+        _length += k;
+        if ( k < room ) { _cur._count += k; return; }
+        _cur._count = _bit_chunk::SIZE;
+        flush();
+        if ( k > room ) { _cur._words[0] = w >> room; _cur._count = k - room; }
+    }
+
+    /** The bitlist of everything appended so far; the writer must not be used afterwards. */
+    bitlist finish()
+    {
+        if ( _cur._count ) { flush(); }
+        auto chunks = empty<bitlist::chunk>();
+        for ( auto c = _done.rbegin(); c != _done.rend(); ++c ) { chunks = std::move( *c ) | std::move( chunks ); }
+        return bitlist( empty<bool>(), std::move( chunks ), 0, _length );
+    }
+};
+
+/**
+ * Evaluates a predicate over a list, packing the results.
+ * @param pred a predicate function
+ * @param xs a finite list or list view
+ * @return a bitlist whose {@code i}-th flag is {@code pred} of the {@code i}-th element of {@code xs}
+ */
+template <typename P, typename A>
+inline bitlist mask( P pred, list_ref<A> xs )
+{
+    _bit_writer out;
+    while ( !null( xs ) ) {
+        std::uint64_t w = 0;
+        unsigned k = 0;
+        for ( ; k < 64 && !null( xs ); ++k, xs = tail( xs ) ) { w |= std::uint64_t( pred( head( xs ) ) ? 1 : 0 ) << k; }
+        out.put( w, k );
+    }
+    return out.finish();
+}
+
+/**
+ * Packs a list of booleans.
+ * @param xs a finite list of booleans
+ * @return a bitlist with the flags of {@code xs}
+ */
+inline bitlist to_bits( list_ref<bool> xs ) { return mask( []( bool x ){ return x; }, xs ); }
+
+/**
+ * Constructs a bitlist by pre-pending a flag, which is kept unpacked.
+ * @param x a flag
+ * @param xs a bitlist
+ * @return a bitlist with {@code x} at the head and {@code xs} as the tail
+ */
+inline bitlist operator| ( bool x, bitlist const& xs )
+{
+    return bitlist( x | xs._front, xs._chunks, xs._offset, xs._length + 1 );
+}
+
+/**
+ * Constructs a bitlist by pre-pending a flag, which is kept unpacked.
+ * @param x a flag
+ * @param xs a bitlist
+ * @return a bitlist with {@code x} at the head and {@code xs} as the tail
+ */
+inline bitlist cons( bool x, bitlist const& xs ) { return x | xs; }
+
+/**
+ * Returns the length of a bitlist in O(1).
+ * @param xs a bitlist
+ * @return the number of flags in {@code xs}
+ */
+inline size_t length( bitlist const& xs ) { return xs._length; }
+
+/**
+ * Test whether a bitlist is empty.
+ * @param xs a bitlist
+ * @return true if {@code xs} is empty, false otherwise
+ */
+inline bool null( bitlist const& xs ) { return length( xs ) == 0; }
+
+/**
+ * Extract the first flag of a bitlist, which must be non-empty.
+ * @param xs a non-empty bitlist
+ * @return the first flag of {@code xs}
+ * @throws std::domain_error if {@code xs} is empty
+ */
+inline bool head( bitlist const& xs )
+{
+    if ( null( xs ) ) { PRELUDE_LIST_FAIL( "prelude::head: empty list" ); }
+    if ( !null( xs._front ) ) { return head( xs._front ); }
+    return ( head( xs._chunks )->_words[xs._offset / 64] >> ( xs._offset % 64 ) ) & 1;
+}
+
+/**
+ * Gets what remains after removing a given number of flags, skipping whole chunks.
+ * @param k a non-negative integer
+ * @param xs a bitlist
+ * @return a sublist of {@code xs} with at most {@code length-k} flags
+ */
+inline bitlist drop( size_t k, bitlist const& xs )
+{
+    if ( k >= xs._length ) { return bitlist( empty<bool>(), empty<bitlist::chunk>(), 0, 0 ); }
+
+    auto n = xs._length - k;
+    list_ref<bool> front = xs._front;
+    for ( ; k > 0 && !null( front ); --k ) { front = tail( front ); }
+    if ( !null( front ) ) { return bitlist( front.own(), xs._chunks, xs._offset, n ); }
+
+    k += xs._offset;
+    list_ref<bitlist::chunk> cs = xs._chunks;
+    while ( k >= head( cs )->_count ) { k -= head( cs )->_count; cs = tail( cs ); }
+    return bitlist( empty<bool>(), cs.own(), k, n );
+}
+
+/**
+ * Extract the flags after the head of a bitlist, in O(1).
+ * @param xs a non-empty bitlist
+ * @return a bitlist containing all but the first flag of {@code xs}
+ * @throws std::domain_error if {@code xs} is empty
+ */
+inline bitlist tail( bitlist const& xs )
+{
+    if ( null( xs ) ) { PRELUDE_LIST_FAIL( "prelude::tail: empty list" ); }
+    return drop( 1, xs );
+}
+
+/**
+ * Counts the true flags of a bitlist by population count, a word at a time; this is
+ * {@code length(filter(id, xs))} without building the filtered list.
+ * @param xs a bitlist
+ * @return the number of flags of {@code xs} that are true
+ */
+inline size_t sum( bitlist const& xs )
+{
+    size_t s = 0;
+    for ( list_ref<bool> e = xs._front; !null( e ); e = tail( e ) ) { s += head( e ); }
+    size_t from = xs._offset;
+    for ( list_ref<bitlist::chunk> cs = xs._chunks; !null( cs ); cs = tail( cs ), from = 0 ) {
+        auto const& c = *head( cs );
+        // Unused bits are zero, so only the skipped prefix of the first chunk needs masking.
+        s += _popcount( c._words[from / 64] & ~_low_bits( ~std::uint64_t( 0 ), from % 64 ) );
+        for ( auto i = from / 64 + 1; i < _bit_chunk::WORDS; ++i ) { s += _popcount( c._words[i] ); }
+    }
+    return s;
+}
+
+/**
+ * The conjunction of a bitlist.
+ * @param xs a bitlist
+ * @return true if every flag of {@code xs} is true
+ */
+inline bool and_( bitlist const& xs ) { return sum( xs ) == length( xs ); }
+
+/**
+ * The disjunction of a bitlist.
+ * @param xs a bitlist
+ * @return true if some flag of {@code xs} is true
+ */
+inline bool or_( bitlist const& xs ) { return sum( xs ) != 0; }
+
+/**
+ * Combines two bitlists a word at a time with a bitwise operator. For internal use only.
+ * @param op a function from two words to a word, applied bit by bit
+ * @param xs a bitlist
+ * @param ys a bitlist
+ * @return a bitlist as long as the shorter of {@code xs} and {@code ys}
+ */
+template <typename F>
+inline bitlist _zip_words( F op, bitlist const& xs, bitlist const& ys )
+{
+    _bit_reader rx( xs ), ry( ys );
+    _bit_writer out;
+    for ( auto n = std::min( length( xs ), length( ys ) ); n > 0; ) {
+        auto k = static_cast<unsigned>( std::min<size_t>( n, 64 ) );
+        out.put( _low_bits( op( rx.next( k ), ry.next( k ) ), k ), k );
+        n -= k;
+    }
+    return out.finish();
+}
+
+/**
+ * Applies a boolean function pairwise to the flags of two bitlists, 64 flags at a time: the
+ * function is evaluated once on each of the four combinations of arguments, and the resulting
+ * truth table applied to whole words.
+ * @param f a pure function from two booleans to a boolean
+ * @param xs a bitlist
+ * @param ys a bitlist
+ * @return a bitlist as long as the shorter of {@code xs} and {@code ys}
+ */
+template <typename F>
+inline bitlist zipWith( F f, bitlist const& xs, bitlist const& ys )
+{
+    auto all = []( bool b ){ return b ? ~std::uint64_t( 0 ) : std::uint64_t( 0 ); };
+    auto ff = all( f( false, false ) ), ft = all( f( false, true ) ), tf = all( f( true, false ) ), tt = all( f( true, true ) );
+    return _zip_words( [=]( std::uint64_t a, std::uint64_t b ){
+        return ( ~a & ~b & ff ) | ( ~a & b & ft ) | ( a & ~b & tf ) | ( a & b & tt );
+    }, xs, ys );
+}
+
+/**
+ * Pairwise conjunction of two bitlists, a word at a time.
+ * @param xs a bitlist
+ * @param ys a bitlist
+ * @return a bitlist as long as the shorter of {@code xs} and {@code ys}
+ */
+inline bitlist operator& ( bitlist const& xs, bitlist const& ys )
+{
+    return _zip_words( []( std::uint64_t a, std::uint64_t b ){ return a & b; }, xs, ys );
+}
+
+/**
+ * Pairwise disjunction of two bitlists, a word at a time.
+ * @param xs a bitlist
+ * @param ys a bitlist
+ * @return a bitlist as long as the shorter of {@code xs} and {@code ys}
+ */
+inline bitlist operator| ( bitlist const& xs, bitlist const& ys )
+{
+    return _zip_words( []( std::uint64_t a, std::uint64_t b ){ return a | b; }, xs, ys );
+}
+
+/**
+ * Negates each flag of a bitlist, a word at a time.
+ * @param xs a bitlist
+ * @return a bitlist of the complements of the flags of {@code xs}
+ */
+inline bitlist operator~ ( bitlist const& xs )
+{
+    return _zip_words( []( std::uint64_t a, std::uint64_t ){ return ~a; }, xs, xs );
+}
+
+/**
+ * Finds the positions of the true flags, skipping a word of false flags at a time
+ * ({@code elemIndices True} in Haskell).
+ * @param xs a bitlist
+ * @return an ascending list of the indices at which {@code xs} is true
+ */
+inline list<size_t> indices( bitlist const& xs )
+{
+    std::vector<size_t> is;
+    is.reserve( sum( xs ) );
+    _bit_reader r( xs );
+    for ( size_t base = 0; r.left() > 0; base += 64 ) {
+        for ( auto w = r.next( static_cast<unsigned>( std::min<size_t>( r.left(), 64 ) ) ); w; w &= w - 1 ) {
+            is.push_back( base + _ctz( w ) );
+        }
+    }
+    auto ys = empty<size_t>();
+    for ( auto i = is.rbegin(); i != is.rend(); ++i ) { ys = *i | std::move( ys ); }
+    return ys;
+}
+
+/**
+ * Keeps the elements of a list at which a bitlist is true, so that
+ * {@code select(mask(p, xs), xs) == filter(p, xs)}.
+ * @param ms a bitlist
+ * @param xs a list
+ * @return the elements of {@code xs} whose flag in {@code ms} is true, in order
+ */
+template <typename A>
+inline list<A> select( bitlist const& ms, list_ref<A> xs )
+{
+    std::vector<A const*> kept;
+    _bit_reader r( ms );
+    while ( r.left() > 0 && !null( xs ) ) {
+        auto k = static_cast<unsigned>( std::min<size_t>( r.left(), 64 ) );
+        auto w = r.next( k );
+        unsigned i = 0;
+        for ( ; w && !null( xs ); w >>= 1, ++i, xs = tail( xs ) ) {
+            if ( w & 1 ) { kept.push_back( &head( xs ) ); }
+        }
+        for ( ; i < k && !null( xs ); ++i ) { xs = tail( xs ); }
+    }
+    auto ys = empty<A>();
+    for ( auto x = kept.rbegin(); x != kept.rend(); ++x ) { ys = **x | std::move( ys ); }
+    return ys;
+}
+
+/**
+ * Unpacks a bitlist into an ordinary list.
+ * @param xs a bitlist
+ * @return a list of the flags of {@code xs}, in order
+ */
+inline list<bool> to_list( bitlist const& xs )
+{
+    std::vector<std::uint64_t> ws;
+    _bit_reader r( xs );
+    while ( r.left() > 0 ) { ws.push_back( r.next( static_cast<unsigned>( std::min<size_t>( r.left(), 64 ) ) ) ); }
+    auto ys = empty<bool>();
+    for ( auto i = length( xs ); i-- > 0; ) { ys = bool( ( ws[i / 64] >> ( i % 64 ) ) & 1 ) | std::move( ys ); }
+    return ys;
+}
+
+/**
+ * Compares two bitlists for equality, a word at a time.
+ * @param xs a bitlist
+ * @param ys a bitlist
+ * @return true if {@code xs} and {@code ys} have the same flags in the same order
+ */
+inline bool operator== ( bitlist const& xs, bitlist const& ys )
+{
+    if ( length( xs ) != length( ys ) ) { return false; }
+    _bit_reader rx( xs ), ry( ys );
+    while ( rx.left() > 0 ) {
+        auto k = static_cast<unsigned>( std::min<size_t>( rx.left(), 64 ) );
+        if ( rx.next( k ) != ry.next( k ) ) { return false; }
+    }
+    return true;
+}
+
+/**
+ * Inserts a character string serialization of a bitlist into an output stream.
+ * @param os an output stream
+ * @param xs a bitlist
+ * @return a reference to the output stream
+ */
+inline std::ostream& operator<< ( std::ostream& os, bitlist const& xs )
+{
+    return os << to_list( xs );
+}
+
+} // end namespace prelude
+
+#endif //HPP_PRELUDE_BITS
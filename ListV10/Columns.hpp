@@ -0,0 +1,229 @@
+#ifndef HPP_PRELUDE_COLUMNS
+#define HPP_PRELUDE_COLUMNS
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "List.hpp"
+
+/**
+ * Implementation of Haskell-like, functional programming idioms, particularly recursive lists.
+ */
+namespace prelude {
+
+/**
+ * Immutable, columnar list of tuples (structure-of-arrays). Rather than one node per
+ * tuple, each field is kept in its own stream of contiguous, shared chunks of up to
+ * {@code CHUNK} elements, so a single field can be projected in O(1) with {@code column}
+ * and then traversed by {@code map} and {@code sum} as plain loops over arrays, which the
+ * compiler is free to vectorise. Every stream of a value is chunked identically.
+ *
+ * @author Matthew A Johnson
+ * @version 1.0
+ */
+template <typename... Ts>
+class columns
+{
+public:
+    /** Number of elements per chunk (all chunks but the last are full). */
+    static constexpr std::size_t CHUNK = 1024;
+
+    template <typename T> using chunk = std::shared_ptr<std::vector<T> const>;
+    template <typename T> using stream = list<chunk<T>>;
+
+private:
+    columns( std::size_t n, std::tuple<stream<Ts>...> ss ) : _length( n ), _streams( std::move( ss ) ) {}
+
+    std::size_t _length;
+    std::tuple<stream<Ts>...> _streams;
+
+    template <typename... Bs> friend class columns;
+    template <typename... Bs> friend std::size_t length( columns<Bs...> const& );
+    template <typename... Bs> friend columns<Bs...> zip_columns( list<Bs> const&... );
+    template <std::size_t I, typename... Bs> friend auto column( columns<Bs...> const& )
+        -> columns<std::tuple_element_t<I, std::tuple<Bs...>>>;
+    template <typename F, typename B> friend auto map( F f, columns<B> const& xs )
+        -> columns<decltype( f( std::declval<B const&>() ) )>;
+    template <typename F, typename B, typename C> friend auto zipWith( F f, columns<B> const&, columns<C> const& )
+        -> columns<decltype( f( std::declval<B const&>(), std::declval<C const&>() ) )>;
+    template <typename B> friend B sum( columns<B> const& );
+    template <typename... Bs> friend auto to_list( columns<Bs...> const& )
+        -> list<std::conditional_t<sizeof...( Bs ) == 1, std::tuple_element_t<0, std::tuple<Bs...>>, std::tuple<Bs...>>>;
+};
+
+/**
+ * Builds a chunk stream from a vector of chunks, in order. For internal use only.
+ */
+template <typename T>
+inline typename columns<T>::template stream<T> _from_chunks( std::vector<typename columns<T>::template chunk<T>>& chunks )
+{
+    auto ss = empty<typename columns<T>::template chunk<T>>();
+    for ( auto i = chunks.rbegin(); i != chunks.rend(); ++i ) { ss = std::move( *i ) | std::move( ss ); }
+    return ss;
+}
+
+/**
+ * Builds a chunk stream from the first {@code n} elements of a list. For internal use only.
+ */
+template <typename T>
+inline typename columns<T>::template stream<T> _chunk_stream( list<T> const& xs, std::size_t n )
+{
+    using chunk = typename columns<T>::template chunk<T>;
+    std::vector<chunk> chunks;
+    std::vector<T> buf;
+    buf.reserve( std::min( n, columns<T>::CHUNK ) );
+    foldl( [&]( std::size_t k, T const& x ){
+        if ( k < n ) {
+            buf.push_back( x );
+            if ( buf.size() == columns<T>::CHUNK ) {
+                chunks.push_back( std::make_shared<std::vector<T> const>( std::move( buf ) ) );
+                buf = std::vector<T>();
+                buf.reserve( std::min( n - k - 1, columns<T>::CHUNK ) );
+            }
+        }
+        return k + 1;
+    }, std::size_t( 0 ), xs );
+    if ( !buf.empty() ) { chunks.push_back( std::make_shared<std::vector<T> const>( std::move( buf ) ) ); }
+    return _from_chunks<T>( chunks );
+}
+
+/**
+ * Returns the number of tuples in a columnar list.
+ * @param cs a columnar list
+ * @return the number of tuples in {@code cs}
+ */
+template <typename... Ts>
+inline std::size_t length( columns<Ts...> const& cs ) { return cs._length; }
+
+/**
+ * Test whether a columnar list is empty.
+ * @param cs a columnar list
+ * @return true if {@code cs} is empty, false otherwise
+ */
+template <typename... Ts>
+inline bool null( columns<Ts...> const& cs ) { return length( cs ) == 0; }
+
+/**
+ * Zips any number of lists into a columnar list, copying each list's elements into its
+ * own chunk stream. The result is as long as the shortest list.
+ * @param xss one or more lists
+ * @return a columnar list whose i-th tuple holds the i-th element of each of {@code xss}
+ */
+template <typename... Ts>
+inline columns<Ts...> zip_columns( list<Ts> const&... xss )
+{
+    auto n = std::min( { length( xss )... } );
+    return columns<Ts...>( n, std::make_tuple( _chunk_stream( xss, n )... ) );
+}
+
+/**
+ * Projects one field of a columnar list. The projection shares the field's chunks.
+ * @param cs a columnar list
+ * @return a single-column list of the {@code I}-th field of each tuple of {@code cs}
+ */
+template <std::size_t I, typename... Ts>
+inline auto column( columns<Ts...> const& cs ) -> columns<std::tuple_element_t<I, std::tuple<Ts...>>>
+{
+    using T = std::tuple_element_t<I, std::tuple<Ts...>>;
+    return columns<T>( cs._length, std::make_tuple( std::get<I>( cs._streams ) ) );
+}
+
+/**
+ * Applies a function to each element of a single-column list, one contiguous chunk at a time.
+ * @param f function that takes an element of {@code xs} and returns a different type
+ * @param xs a single-column list
+ * @return a single-column list of the results of {@code f}
+ */
+template <typename F, typename A>
+inline auto map( F f, columns<A> const& xs ) -> columns<decltype( f( std::declval<A const&>() ) )>
+{
+    using B = decltype( f( std::declval<A const&>() ) );
+    std::vector<typename columns<B>::template chunk<B>> chunks;
+    for ( auto ss = std::get<0>( xs._streams ); !null( ss ); ss = tail( ss ) ) {
+        auto const& in = *head( ss );
+        std::vector<B> out( in.size() );
+        for ( std::size_t i = 0; i < in.size(); ++i ) { out[i] = f( in[i] ); }
+        chunks.push_back( std::make_shared<std::vector<B> const>( std::move( out ) ) );
+    }
+    return columns<B>( xs._length, std::make_tuple( _from_chunks<B>( chunks ) ) );
+}
+
+/**
+ * Combines two single-column lists element-wise with a function, one pair of contiguous
+ * chunks at a time. The result is as long as the shorter list.
+ * @param f a binary function taking an element of {@code xs} then one of {@code ys}
+ * @param xs a single-column list
+ * @param ys a single-column list
+ * @return a single-column list of the results of {@code f} applied to corresponding elements
+ */
+template <typename F, typename A, typename B>
+inline auto zipWith( F f, columns<A> const& xs, columns<B> const& ys )
+    -> columns<decltype( f( std::declval<A const&>(), std::declval<B const&>() ) )>
+{
+    using C = decltype( f( std::declval<A const&>(), std::declval<B const&>() ) );
+    std::vector<typename columns<C>::template chunk<C>> chunks;
+    auto as = std::get<0>( xs._streams );
+    auto bs = std::get<0>( ys._streams );
+    for ( ; !null( as ) && !null( bs ); as = tail( as ), bs = tail( bs ) ) {
+        auto const& l = *head( as );
+        auto const& r = *head( bs );
+        std::vector<C> out( std::min( l.size(), r.size() ) );
+        for ( std::size_t i = 0; i < out.size(); ++i ) { out[i] = f( l[i], r[i] ); }
+        chunks.push_back( std::make_shared<std::vector<C> const>( std::move( out ) ) );
+    }
+    return columns<C>( std::min( xs._length, ys._length ), std::make_tuple( _from_chunks<C>( chunks ) ) );
+}
+
+/**
+ * The {@code sum} function computes the sum of a single-column list of numbers.
+ * @param xs a single-column list
+ * @return the sum of each element of {@code xs}
+ */
+template <typename A>
+inline A sum( columns<A> const& xs )
+{
+    A result = 0;
+    for ( auto ss = std::get<0>( xs._streams ); !null( ss ); ss = tail( ss ) ) {
+        auto const& c = *head( ss );
+        A partial = 0;
+        for ( std::size_t i = 0; i < c.size(); ++i ) { partial += c[i]; }
+        result += partial;
+    }
+    return result;
+}
+
+/**
+ * Converts a columnar list back to an ordinary list: of elements for a single column,
+ * otherwise of tuples.
+ * @param cs a columnar list
+ * @return a list of the tuples (or elements) of {@code cs}, in order
+ */
+template <typename... Ts>
+inline auto to_list( columns<Ts...> const& cs )
+    -> list<std::conditional_t<sizeof...( Ts ) == 1, std::tuple_element_t<0, std::tuple<Ts...>>, std::tuple<Ts...>>>
+{
+    using R = std::conditional_t<sizeof...( Ts ) == 1, std::tuple_element_t<0, std::tuple<Ts...>>, std::tuple<Ts...>>;
+    std::vector<std::tuple<std::vector<Ts> const*...>> blocks;
+    std::apply( [&]( auto... ss ){
+        for ( ; ( !null( ss ) && ... ); ( ( ss = tail( ss ) ), ... ) ) {
+            blocks.emplace_back( head( ss ).get()... );
+        }
+    }, cs._streams );
+
+    auto ys = empty<R>();
+    for ( auto b = blocks.rbegin(); b != blocks.rend(); ++b ) {
+        auto k = std::get<0>( *b )->size();
+        while ( k-- ) {
+            ys = std::apply( [k]( auto... cols ){ return R( ( *cols )[k]... ); }, *b ) | std::move( ys );
+        }
+    }
+    return ys;
+}
+
+} // end namespace prelude
+
+#endif //HPP_PRELUDE_COLUMNS
@@ -0,0 +1,235 @@
+#ifndef HPP_PRELUDE_DLIST
+#define HPP_PRELUDE_DLIST
+
+#include <memory>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+#include "List.hpp"
+
+/**
+ * Implementation of Haskell-like, functional programming idioms, particularly recursive lists.
+ */
+namespace prelude {
+
+/**
+ * Immutable node of a difference list: either a piece, a non-empty list, or the concatenation
+ * of two non-empty difference lists. For internal use only.
+ */
+template <typename A>
+struct _dlist_node
+{
+    using ptr = std::shared_ptr<_dlist_node const>;
+
+    list<A> _piece;
+    ptr     _left;
+    ptr     _right;
+
+    /**
+     * Destroys this node and any sub-trees it solely owns, iteratively: repeated {@code snoc}
+     * builds a tree as deep as it has pieces, too deep for recursive destruction.
+     */
+    ~_dlist_node()
+    {
+        if ( !_left ) { return; }
+        std::vector<ptr> pending;
+        pending.push_back( std::move( _left ) );
+        pending.push_back( std::move( _right ) );
+        while ( !pending.empty() ) {
+            auto t = std::move( pending.back() );
+            pending.pop_back();
+            if ( t.use_count() == 1 && t->_left ) {
+                auto& u = const_cast<_dlist_node&>( *t );
+                pending.push_back( std::move( u._left ) );
+                pending.push_back( std::move( u._right ) );
+            }
+        }
+    }
+};
+
+/**
+ * Difference list: a list under construction that can be extended at either end, or joined
+ * to another, in O(1). Pieces are recorded in a tree of shared nodes rather than linked, and
+ * {@code to_list} links them all in one left-to-right pass, copying each element once.
+ * Building output with repeated
+ * {@code xs + ys} or {@code xs + (y | empty<A>())} copies the left operand each time,
+ * so the total cost is quadratic; with a dlist it is linear.
+ *
+ * @author Matthew A Johnson
+ * @version 1.0
+ */
+template <typename A>
+class dlist
+{
+    using node = _dlist_node<A>;
+    using ptr = typename node::ptr;
+
+public:
+    /**
+     * Constructs an empty difference list.
+     */
+    dlist() = default;
+
+    /**
+     * Constructs a difference list of the elements of a list, in O(1), sharing its nodes.
+     * @param xs a finite list
+     */
+    explicit dlist( list<A> xs )
+        : _root( null( xs ) ? nullptr : std::make_shared<node>( node{ std::move( xs ), nullptr, nullptr } ) ) {}
+
+private:
+    // Root of the tree of pieces, or nullptr for the empty list.
+    ptr _root;
+
+    explicit dlist( ptr t ) : _root( std::move( t ) ) {}
+
+    template <typename B> friend dlist<B> operator+ ( dlist<B> const&, dlist<B> const& );
+    template <typename B> friend bool null( dlist<B> const& );
+    template <typename F, typename B, typename C> friend B foldl( F, B, dlist<C> const& );
+    template <typename B> friend list<B> to_list( dlist<B> const& );
+};
+
+/**
+ * Appends one difference list to another, in O(1).
+ * @param xs a difference list
+ * @param ys a difference list
+ * @return a difference list in which the elements of {@code xs} precede those of {@code ys}
+ */
+template <typename A>
+inline dlist<A> operator+ ( dlist<A> const& xs, dlist<A> const& ys )
+{
+    if ( !xs._root ) { return ys; }
+    if ( !ys._root ) { return xs; }
+    using node = _dlist_node<A>;
+    return dlist<A>( std::make_shared<node>( node{ empty<A>(), xs._root, ys._root } ) );
+}
+
+/**
+ * Appends one difference list to another, in O(1).
+ * @param xs a difference list
+ * @param ys a difference list
+ * @return a difference list in which the elements of {@code xs} precede those of {@code ys}
+ */
+template <typename A>
+inline dlist<A> append( dlist<A> const& xs, dlist<A> const& ys ) { return xs + ys; }
+
+/**
+ * Constructs a difference list by pre-pending an element, in O(1).
+ * @param x an element
+ * @param xs a difference list
+ * @return a difference list with {@code x} followed by the elements of {@code xs}
+ */
+template <typename A>
+inline dlist<A> operator| ( A x, dlist<A> const& xs ) { return dlist<A>( list<A>( { std::move( x ) } ) ) + xs; }
+
+/**
+ * Constructs a difference list by pre-pending an element, in O(1).
+ * @param x an element
+ * @param xs a difference list
+ * @return a difference list with {@code x} followed by the elements of {@code xs}
+ */
+template <typename A>
+inline dlist<A> cons( A x, dlist<A> const& xs ) { return std::move( x ) | xs; }
+
+/**
+ * Constructs a difference list by appending an element, in O(1).
+ * @param xs a difference list
+ * @param x an element
+ * @return a difference list with the elements of {@code xs} followed by {@code x}
+ */
+template <typename A>
+inline dlist<A> snoc( dlist<A> const& xs, A x ) { return xs + dlist<A>( list<A>( { std::move( x ) } ) ); }
+
+/**
+ * Concatenates many difference lists, in time proportional to their number.
+ * @param xss a finite list of difference lists
+ * @return a difference list of the elements of each of {@code xss} in turn
+ */
+template <typename A>
+inline dlist<A> concat( list_ref<dlist<A>> xss )
+{
+    return foldl( []( dlist<A> xs, dlist<A> const& ys ){ return xs + ys; }, dlist<A>(), xss );
+}
+
+/**
+ * Test whether a difference list is empty.
+ * @param xs a difference list
+ * @return true if {@code xs} is empty, false otherwise
+ */
+template <typename A>
+inline bool null( dlist<A> const& xs ) { return !xs._root; }
+
+/**
+ * Left-associative fold of a difference list, visiting its pieces in order without linking them.
+ * @param f a binary operator taking the accumulator then an element
+ * @param z the starting value of the accumulator
+ * @param xs a difference list
+ * @return the final value of the accumulator
+ */
+template <typename F, typename B, typename A>
+inline B foldl( F f, B z, dlist<A> const& xs )
+{
+    std::vector<_dlist_node<A> const*> todo;
+    if ( xs._root ) { todo.push_back( xs._root.get() ); }
+    while ( !todo.empty() ) {
+        auto t = todo.back();
+        todo.pop_back();
+        if ( t->_left ) { todo.push_back( t->_right.get() ); todo.push_back( t->_left.get() ); continue; }
+        z = foldl( f, std::move( z ), t->_piece );
+    }
+    return z;
+}
+
+/**
+ * Returns the length of a difference list.
+ * @param xs a difference list
+ * @return the number of elements in {@code xs}
+ */
+template <typename A>
+inline size_t length( dlist<A> const& xs )
+{
+    return foldl( []( size_t n, A const& ){ return n + 1; }, size_t( 0 ), xs );
+}
+
+/**
+ * Links the pieces of a difference list into a list in one front-to-back pass. Every node is
+ * fresh, so the result can be extended in place by the move versions of {@code +}.
+ * @param xs a difference list
+ * @return a list of the elements of {@code xs}, in order
+ */
+template <typename A>
+inline list<A> to_list( dlist<A> const& xs )
+{
+    using node = typename list<A>::node;
+    auto ys = empty<A>();
+    node* to = nullptr;
+    std::vector<_dlist_node<A> const*> todo;
+    if ( xs._root ) { todo.push_back( xs._root.get() ); }
+    while ( !todo.empty() ) {
+        auto t = todo.back();
+        todo.pop_back();
+        if ( t->_left ) { todo.push_back( t->_right.get() ); todo.push_back( t->_left.get() ); continue; }
+        for ( auto e = t->_piece._rep; e; e = e->_tail ) {
+            to = ( to ? to->_tail : ys._rep ) = list<A>::acquire( new node( e->_head ) );
+        }
+    }
+    if ( to ) { list<A>::seal( ys._rep, to ); }
+    return ys;
+}
+
+/**
+ * Inserts a character string serialization of a difference list into an output stream.
+ * @param os an output stream
+ * @param xs a difference list
+ * @return a reference to the output stream
+ */
+template <typename A>
+std::ostream& operator<< ( std::ostream& os, dlist<A> const& xs )
+{
+    return os << to_list( xs );
+}
+
+} // end namespace prelude
+
+#endif //HPP_PRELUDE_DLIST
@@ -0,0 +1,296 @@
+#ifndef HPP_PRELUDE_EPOCH_LIST
+#define HPP_PRELUDE_EPOCH_LIST
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "List.hpp"
+
+/**
+ * Implementation of Haskell-like, functional programming idioms, particularly recursive lists.
+ */
+namespace prelude {
+
+/**
+ * Process-wide epoch-based reclamation registry. For internal use only.
+ * Each reader thread owns one slot, holding the global epoch it observed on entering a
+ * read-side critical section (or zero when outside one). Writers retire claims on nodes
+ * tagged with the current epoch; the global epoch only advances once every active reader
+ * has observed it, so a claim retired at epoch e is released once the epoch reaches e + 2,
+ * by which time no reader that could have seen the nodes is still running.
+ */
+class _epoch_domain
+{
+public:
+    /** Maximum number of threads that may read shared lists concurrently. */
+    static constexpr std::size_t SLOTS = 256;
+
+    using retired = std::pair<void*, void (*)( void* )>;
+
+    static _epoch_domain& instance() { static _epoch_domain d; return d; }
+
+    /** Enters a (possibly nested) read-side critical section on the calling thread. */
+    static void enter()
+    {
+        auto& rec = local();
+        if ( rec._depth++ ) { return; }
+        auto& d = instance();
+        std::uint64_t e;
+        do {
+            e = d._epoch.load();
+            rec._slot.store( ( e << 1 ) | 1 );
+        } while ( e != d._epoch.load() );
+    }
+    /** Leaves a read-side critical section on the calling thread. */
+    static void leave()
+    {
+        auto& rec = local();
+        if ( !--rec._depth ) { rec._slot.store( 0 ); }
+    }
+
+    /**
+     * Defers a release until no reader can still observe {@code p}.
+     * @param p a retired pointer
+     * @param reclaim function that releases {@code p}
+     */
+    void retire( void* p, void (*reclaim)( void* ) )
+    {
+        std::lock_guard<std::mutex> lock( _limbo_lock );
+        _limbo.push_back( { _epoch.load(), { p, reclaim } } );
+        collect_locked();
+    }
+    /** Advances the epoch if possible and releases whatever has become unobservable. */
+    void collect()
+    {
+        std::lock_guard<std::mutex> lock( _limbo_lock );
+        collect_locked();
+    }
+
+    ~_epoch_domain() { for ( auto& r : _limbo ) { r.second.second( r.second.first ); } }
+
+private:
+    _epoch_domain() : _epoch( 1 ), _slots(), _owned() {}
+
+    struct record
+    {
+        record() : _slot( instance().claim() ), _depth( 0 ) {}
+        ~record() { _slot.store( 0 ); instance()._owned[&_slot - instance()._slots].store( false ); }
+        std::atomic<std::uint64_t>& _slot;
+        std::size_t                 _depth;
+    };
+
+    static record& local() { thread_local record rec; return rec; }
+
+    std::atomic<std::uint64_t>& claim()
+    {
+        for ( std::size_t i = 0; i < SLOTS; ++i ) {
+            bool expected = false;
+            if ( _owned[i].compare_exchange_strong( expected, true ) ) { return _slots[i]; }
+        }
+        throw std::runtime_error("prelude::shared_list: too many threads");
+    }
+
+    void collect_locked()
+    {
+        auto e = _epoch.load();
+        bool quiescent = true;
+        for ( auto& s : _slots ) {
+            auto v = s.load();
+            if ( ( v & 1 ) && ( v >> 1 ) != e ) { quiescent = false; break; }
+        }
+        if ( quiescent ) { _epoch.compare_exchange_strong( e, e + 1 ); e = _epoch.load(); }
+
+        std::vector<std::pair<std::uint64_t, retired>> kept;
+        for ( auto& r : _limbo ) {
+            if ( r.first + 2 <= e ) {
+                r.second.second( r.second.first );
+            } else {
+                kept.push_back( r );
+            }
+        }
+        _limbo.swap( kept );
+    }
+
+    std::atomic<std::uint64_t> _epoch;
+    std::atomic<std::uint64_t> _slots[SLOTS];
+    std::atomic<bool>          _owned[SLOTS];
+    std::mutex                 _limbo_lock;
+    std::vector<std::pair<std::uint64_t, retired>> _limbo;
+};
+
+/**
+ * Read-side critical section. While a guard is alive on a thread, nodes read from any
+ * {@code shared_list} through an {@code epoch_view} stay allocated.
+ */
+class epoch_guard
+{
+public:
+    epoch_guard() { _epoch_domain::enter(); }
+    ~epoch_guard() { _epoch_domain::leave(); }
+    epoch_guard( epoch_guard const& ) = delete;
+    epoch_guard& operator= ( epoch_guard const& ) = delete;
+};
+
+/**
+ * Non-owning view of a list published through a {@code shared_list}. Traversing a view
+ * reads raw node pointers and performs no reference-count writes, so any number of reader
+ * threads can walk the same list without contending on its cache lines. A view is only
+ * valid inside the {@code epoch_guard} that was passed to obtain it.
+ *
+ * @author Matthew A Johnson
+ * @version 1.0
+ */
+template <typename A>
+class epoch_view
+{
+    using node = typename list<A>::node;
+public:
+    /**
+     * Casting operator permits type-conversion from view to boolean for use in test expressions.
+     */
+    explicit operator bool() const { return _rep != nullptr; }
+
+private:
+    explicit epoch_view( node const* n ) : _rep( n ) {}
+    std::size_t size() const { return list<A>::size_of( _rep ); }
+    node const* _rep;
+
+    template <typename B> friend class shared_list;
+    template <typename B> friend B const& head( epoch_view<B> );
+    template <typename B> friend epoch_view<B> tail( epoch_view<B> );
+    template <typename B> friend std::size_t length( epoch_view<B> );
+    template <typename B> friend B sum( epoch_view<B> );
+};
+
+/**
+ * Test whether a view is of the empty list.
+ * @param xs a view
+ * @return true if {@code xs} is empty, false otherwise
+ */
+template <typename A>
+inline bool null( epoch_view<A> xs ) { return !xs; }
+
+/**
+ * Extract the first element of a viewed list, which must be non-empty.
+ * @param xs a view of a non-empty list
+ * @return the first element of {@code xs}
+ * @throws std::domain_error if {@code xs} is empty
+ */
+template <typename A>
+inline A const& head( epoch_view<A> xs )
+{
+    if ( null( xs ) ) { throw std::domain_error("prelude::head: empty list"); }
+    return xs._rep->_head;
+}
+
+/**
+ * View the elements after the head of a viewed list, which must be non-empty.
+ * @param xs a view of a non-empty list
+ * @return a view of all but the first element of {@code xs}
+ * @throws std::domain_error if {@code xs} is empty
+ */
+template <typename A>
+inline epoch_view<A> tail( epoch_view<A> xs )
+{
+    if ( null( xs ) ) { throw std::domain_error("prelude::tail: empty list"); }
+    return epoch_view<A>( xs._rep->_tail );
+}
+
+/**
+ * Returns the length of a viewed list.
+ * @param xs a view
+ * @return the number of elements in {@code xs}
+ */
+template <typename A>
+inline std::size_t length( epoch_view<A> xs ) { return xs.size(); }
+
+/**
+ * The {@code sum} function computes the sum of a viewed list of numbers.
+ * @param xs a view
+ * @return the sum of each element of {@code xs}
+ */
+template <typename A>
+inline A sum( epoch_view<A> xs )
+{
+    A result = 0;
+    for ( auto e = xs._rep; e; e = e->_tail ) { result += e->_head; }
+    return result;
+}
+
+/**
+ * Mutable handle to a read-mostly list shared between threads. Writers {@code publish}
+ * new versions; readers {@code read} the current version as an {@code epoch_view} inside
+ * an {@code epoch_guard} without touching reference counts. The handle's claim on a
+ * replaced version is released only after every reader epoch has moved past it.
+ * Writers are serialised by the handle. Lists returned by {@code snapshot} may be shared
+ * across threads only when reference counts are atomic (PRELUDE_LIST_ATOMIC_REFS).
+ *
+ * @author Matthew A Johnson
+ * @version 1.0
+ */
+template <typename A>
+class shared_list
+{
+    using node = typename list<A>::node;
+public:
+    /**
+     * Constructs a handle whose initial version is the specified list.
+     * @param xs the initial list
+     */
+    explicit shared_list( list<A> xs = empty<A>() ) : _rep( xs._rep ) { xs._rep = nullptr; }
+    shared_list( shared_list const& ) = delete;
+    shared_list& operator= ( shared_list const& ) = delete;
+    /**
+     * Destroys this handle. Must not race with any other operation on it.
+     */
+    ~shared_list() { list<A>::release( _rep.load() ); }
+
+    /**
+     * Views the current version without acquiring it.
+     * @param guard the read-side critical section within which the view is used
+     * @return a view of the current version
+     */
+    epoch_view<A> read( epoch_guard const& guard ) const
+    {
+        (void) guard;
+        return epoch_view<A>( _rep.load() );
+    }
+
+    /**
+     * Gets the current version as an owning list.
+     * @return the current version
+     */
+    list<A> snapshot() const
+    {
+        std::lock_guard<std::mutex> lock( _writer );
+        return list<A>( _rep.load() );
+    }
+
+    /**
+     * Replaces the current version. The previous version is reclaimed once no reader
+     * can still be viewing it.
+     * @param xs the new version
+     */
+    void publish( list<A> xs )
+    {
+        std::lock_guard<std::mutex> lock( _writer );
+        auto old = _rep.exchange( xs._rep );
+        xs._rep = nullptr;
+        if ( old ) {
+            _epoch_domain::instance().retire( old, []( void* n ){ list<A>::release( static_cast<node*>( n ) ); } );
+        }
+    }
+
+private:
+    std::atomic<node*> _rep;
+    mutable std::mutex _writer;
+};
+
+} // end namespace prelude
+
+#endif //HPP_PRELUDE_EPOCH_LIST
@@ -0,0 +1,417 @@
+#ifndef HPP_PRELUDE_GENERATOR
+#define HPP_PRELUDE_GENERATOR
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <utility>
+
+#include "List.hpp"
+
+/**
+ * Implementation of Haskell-like, functional programming idioms, particularly recursive lists.
+ */
+namespace prelude {
+
+/**
+ * Pull-based, lazily evaluated sequence of elements produced by a C++20 coroutine.
+ * A generator computes nothing until an element is requested, so producers such as
+ * parsers, random number streams or (possibly infinite) enumerations can feed
+ * {@code map}/{@code filter}/{@code take} pipelines without building the whole list
+ * first. A generator is a single-pass, move-only handle; use {@code lift} to turn it
+ * into a {@code lazy_list}, or {@code take} or {@code to_list} to materialise (part of)
+ * it as an immutable {@code list}.
+ *
+ * @author Matthew A Johnson
+ * @version 1.0
+ */
+template <typename A>
+class generator
+{
+public:
+    struct promise_type
+    {
+        std::optional<A>   _value;
+        std::exception_ptr _error;
+
+        generator get_return_object()
+            { return generator( std::coroutine_handle<promise_type>::from_promise( *this ) ); }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        std::suspend_always yield_value( A x ) { _value.emplace( std::move( x ) ); return {}; }
+        void return_void() {}
+        void unhandled_exception() { _error = std::current_exception(); }
+    };
+
+    /**
+     * Input iterator over the remaining elements of a generator.
+     */
+    class iterator
+    {
+    public:
+        using value_type = A;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() : _coro( nullptr ) {}
+        explicit iterator( std::coroutine_handle<promise_type> h ) : _coro( h ) {}
+
+        A const& operator* () const { return *_coro.promise()._value; }
+        iterator& operator++ () { advance( _coro ); return *this; }
+        void operator++ ( int ) { ++*this; }
+        bool operator== ( std::default_sentinel_t ) const { return !_coro || _coro.done(); }
+
+    private:
+        std::coroutine_handle<promise_type> _coro;
+    };
+
+    generator( generator && g ) noexcept : _coro( std::exchange( g._coro, nullptr ) ), _started( g._started ) {}
+    generator& operator= ( generator && g ) noexcept
+        { if ( this != &g ) { destroy(); _coro = std::exchange( g._coro, nullptr ); _started = g._started; } return *this; }
+    generator( generator const& ) = delete;
+    generator& operator= ( generator const& ) = delete;
+    /**
+     * Destroys this generator along with its suspended coroutine frame.
+     */
+    ~generator() { destroy(); }
+
+    /**
+     * Resumes the producer until it yields its next element.
+     * @return an iterator positioned on the next element, or equal to {@code end()} if none remain
+     */
+    iterator begin() { if ( _coro && !_started ) { _started = true; advance( _coro ); } return iterator( _coro ); }
+    std::default_sentinel_t end() { return {}; }
+
+private:
+    explicit generator( std::coroutine_handle<promise_type> h ) : _coro( h ) {}
+
+    /** Resumes the coroutine, rethrowing anything it threw. */
+    static void advance( std::coroutine_handle<promise_type> h )
+    {
+        h.promise()._value.reset();
+        h.resume();
+        if ( h.promise()._error ) { std::rethrow_exception( h.promise()._error ); }
+    }
+    void destroy() { if ( _coro ) { _coro.destroy(); } }
+
+    std::coroutine_handle<promise_type> _coro;
+    bool _started = false;
+};
+
+// Producers
+
+/**
+ * Infinite generator of repeated applications of a function to a value, i.e.,
+ *     {@code iterate(f, x) == [x, f(x), f(f(x)), ...]}
+ * @param f a function from the element type to itself
+ * @param x the first element
+ * @return a generator of {@code x} and its successive images under {@code f}
+ */
+template <typename F, typename A>
+generator<A> iterate( F f, A x )
+{
+    for ( ;; ) {
+        co_yield x;
+        x = f( x );
+    }
+}
+
+/**
+ * Generator over the elements of a list. The generator holds a reference to the list,
+ * so its nodes stay alive for as long as the generator does.
+ * @param xs a list
+ * @return a generator yielding the elements of {@code xs} in order
+ */
+template <typename A>
+generator<A> to_generator( list<A> xs )
+{
+    while ( !null( xs ) ) {
+        co_yield head( xs );
+        xs = tail( xs );
+    }
+}
+
+// Lazy transformations
+
+/**
+ * Lazily applies a function to each element produced by a generator.
+ * @param f function that takes an element of {@code g} and returns a different type
+ * @param g a generator
+ * @return a generator of elements the same type as the return type of {@code f}
+ */
+template <typename F, typename A>
+auto map( F f, generator<A> g ) -> generator<decltype( f( std::declval<A const&>() ) )>
+{
+    for ( auto const& x : g ) {
+        co_yield f( x );
+    }
+}
+
+/**
+ * Lazily selects those elements produced by a generator that satisfy a predicate.
+ * @param pred a predicate function
+ * @param g a generator
+ * @return a generator of the elements of {@code g} satisfying {@code pred}
+ */
+template <typename P, typename A>
+generator<A> filter( P pred, generator<A> g )
+{
+    for ( auto const& x : g ) {
+        if ( pred( x ) ) { co_yield x; }
+    }
+}
+
+// Lazy lists
+
+/**
+ * Immutable list whose elements are produced on demand by a generator, i.e., a generator
+ * lifted into a list. Each element is produced once, when a traversal first reaches it, and
+ * is kept in a list node that every copy of the list shares, so unlike a generator a lazy
+ * list may be copied and traversed any number of times. Nodes that no lazy list can reach
+ * any more are freed as the traversals move on. Producing elements updates the shared nodes,
+ * so a lazy list must not be traversed by several threads at once.
+ *
+ * @author Matthew A Johnson
+ * @version 1.0
+ */
+template <typename A>
+class lazy_list
+{
+    using node = typename list<A>::template partial_node<generator<A>>;
+public:
+    /**
+     * Constructs the empty lazy list.
+     */
+    lazy_list() : _rep( nullptr ) {}
+    lazy_list( lazy_list const& xs ) : _rep( acquire( xs._rep ) ) {}
+    lazy_list( lazy_list && xs ) noexcept : _rep( std::exchange( xs._rep, nullptr ) ) {}
+    /**
+     * Destroys this lazy list, freeing the nodes (and the generator) it alone could reach.
+     */
+    ~lazy_list() { release( _rep ); }
+
+    lazy_list& operator= ( lazy_list const& xs ) { auto n = acquire( xs._rep ); release( _rep ); _rep = n; return *this; }
+    lazy_list& operator= ( lazy_list && xs ) noexcept { std::swap( _rep, xs._rep ); return *this; }
+
+private:
+    // Pointer to the first node, or nullptr when the list is empty.
+    node* _rep;
+
+    /** Constructs a lazy list from its first node. For internal use only. */
+    explicit lazy_list( node* n ) : _rep( acquire( n ) ) {}
+
+    static node* acquire( node* n ) { return static_cast<node*>( list<A>::acquire( n ) ); }
+    /** Drops a claim on a node, iterating down the tail so a long list is not freed recursively. */
+    static void release( node* n )
+    {
+        while ( n && !--(n->_refs) ) {
+            auto next = static_cast<node*>( n->_tail );
+            n->_tail = nullptr;
+            delete n;
+            n = next;
+        }
+    }
+    /**
+     * Gets the node after {@code n}, resuming the generator first if {@code n} is the last
+     * produced so far. Once the generator is exhausted (or has thrown) {@code n} is the last node.
+     */
+    static node* next( node* n )
+    {
+        if ( n->_pending ) {
+            auto i = n->_gen.begin();
+            if ( i != n->_gen.end() && ++i != n->_gen.end() ) {
+                n->_tail = list<A>::acquire( new node( *i, std::move( n->_gen ) ) );
+            }
+            n->settle();
+        }
+        return static_cast<node*>( n->_tail );
+    }
+    /**
+     * Copies elements into a new list, front to back, pulling each one from {@code more},
+     * which gives a pointer to the next element or nullptr once there are none. After the
+     * {@code k}th element {@code more} is not called again, so no further element is produced.
+     */
+    template <typename F>
+    static list<A> copy( std::size_t k, F more )
+    {
+        list<A> ys;
+        typename list<A>::node* last = nullptr;
+        for ( A const* x; k > 0 && ( x = more() ); --k ) {
+            auto n = list<A>::acquire( new typename list<A>::node( *x ) );
+            ( last ? last->_tail : ys._rep ) = n;
+            last = n;
+        }
+        list<A>::seal( ys._rep, last );
+        return ys;
+    }
+    /** Source of elements for {@code copy} that resumes a generator, starting it only when first pulled. */
+    static auto from( generator<A>& g )
+    {
+        return [&g, i = typename generator<A>::iterator(), first = true]() mutable -> A const* {
+            if ( first ) { i = g.begin(); first = false; } else { ++i; }
+            return i != g.end() ? &*i : nullptr;
+        };
+    }
+    /** Source of elements for {@code copy} that walks the nodes from {@code n}, producing those not yet produced. */
+    static auto from( node* n )
+    {
+        return [n, first = true]() mutable -> A const* {
+            if ( first ) { first = false; } else if ( n ) { n = next( n ); }
+            return n ? &n->_head : nullptr;
+        };
+    }
+
+    template <typename B> friend lazy_list<B> lift( generator<B> );
+    template <typename B> friend bool null( lazy_list<B> const& );
+    template <typename B> friend B const& head( lazy_list<B> const& );
+    template <typename B> friend lazy_list<B> tail( lazy_list<B> const& );
+    template <typename B> friend list<B> take( unsigned, lazy_list<B> const& );
+    template <typename B> friend list<B> to_list( lazy_list<B> const& );
+    template <typename B> friend list<B> take( unsigned, generator<B> );
+    template <typename B> friend list<B> to_list( generator<B> );
+};
+
+/**
+ * Lifts a generator into a lazy list of the elements it produces. The first element is
+ * produced here; each further one when the tail before it is first taken.
+ * @param g a generator
+ * @return a lazy list of the elements produced by {@code g}
+ */
+template <typename A>
+lazy_list<A> lift( generator<A> g )
+{
+    using node = typename lazy_list<A>::node;
+
+    auto i = g.begin();
+    if ( i == g.end() ) { return lazy_list<A>(); }
+    return lazy_list<A>( new node( *i, std::move( g ) ) );
+}
+
+/**
+ * Test whether a lazy list is empty.
+ * @param xs a lazy list
+ * @return true if {@code xs} is empty, false otherwise
+ */
+template <typename A>
+inline bool null( lazy_list<A> const& xs ) { return !xs._rep; }
+
+/**
+ * Extract the first element of a lazy list, which must be non-empty.
+ * @param xs a non-empty lazy list
+ * @return the first element of {@code xs}
+ * @throws std::domain_error if {@code xs} is empty
+ */
+template <typename A>
+inline A const& head( lazy_list<A> const& xs )
+{
+    if ( null( xs ) ) { PRELUDE_LIST_FAIL( "prelude::head: empty list" ); }
+    return xs._rep->_head;
+}
+
+/**
+ * Extract the first element of a temporary lazy list, which must be non-empty. The element
+ * is copied out, since the nodes of {@code xs} may be freed at the end of the full-expression.
+ * @param xs a non-empty lazy list
+ * @return the first element of {@code xs}
+ * @throws std::domain_error if {@code xs} is empty
+ */
+template <typename A>
+inline A head( lazy_list<A>&& xs ) { return head( static_cast<lazy_list<A> const&>( xs ) ); }
+
+/**
+ * Extract the elements after the head of a lazy list, which must be non-empty, producing
+ * the second element if no traversal has reached it yet.
+ * @param xs a non-empty lazy list
+ * @return a lazy list containing all but the first element of {@code xs}
+ * @throws std::domain_error if {@code xs} is empty
+ */
+template <typename A>
+inline lazy_list<A> tail( lazy_list<A> const& xs )
+{
+    if ( null( xs ) ) { PRELUDE_LIST_FAIL( "prelude::tail: empty list" ); }
+    return lazy_list<A>( lazy_list<A>::next( xs._rep ) );
+}
+
+/**
+ * Drops the first {@code k} elements of a lazy list, producing them if need be.
+ * @param k a non-negative integer
+ * @param xs a lazy list
+ * @return the suffix of {@code xs} after its first {@code k} elements, or empty if it has fewer
+ */
+template <typename A>
+lazy_list<A> drop( unsigned k, lazy_list<A> xs )
+{
+    for ( ; k > 0 && !null( xs ); --k ) { xs = tail( xs ); }
+    return xs;
+}
+
+/**
+ * Copies at most {@code k} elements of a lazy list into a list, producing only those not
+ * produced before, so {@code xs} may be infinite.
+ * @param k a non-negative integer
+ * @param xs a lazy list
+ * @return a list of the first (at most) {@code k} elements of {@code xs}
+ */
+template <typename A>
+list<A> take( unsigned k, lazy_list<A> const& xs ) { return lazy_list<A>::copy( k, lazy_list<A>::from( xs._rep ) ); }
+
+/**
+ * Copies every element of a finite lazy list into a list.
+ * @param xs a finite lazy list
+ * @return a list of the elements of {@code xs}
+ */
+template <typename A>
+list<A> to_list( lazy_list<A> const& xs ) { return lazy_list<A>::copy( std::size_t( -1 ), lazy_list<A>::from( xs._rep ) ); }
+
+/**
+ * Generator over the elements of a lazy list, producing them as it goes. The generator
+ * holds a reference to the lazy list, so its nodes stay alive for as long as the generator does.
+ * @param xs a lazy list
+ * @return a generator yielding the elements of {@code xs} in order
+ */
+template <typename A>
+generator<A> to_generator( lazy_list<A> xs )
+{
+    while ( !null( xs ) ) {
+        co_yield head( xs );
+        xs = tail( xs );
+    }
+}
+
+// Materialisation
+
+/**
+ * Pulls at most {@code k} elements from a generator into a list. The producer is
+ * resumed only {@code k} times, so {@code g} may be infinite.
+ * @param k a non-negative integer
+ * @param g a generator
+ * @return a list of the first (at most) {@code k} elements produced by {@code g}
+ */
+template <typename A>
+list<A> take( unsigned k, generator<A> g ) { return lazy_list<A>::copy( k, lazy_list<A>::from( g ) ); }
+
+/**
+ * Pulls every element from a finite generator into a list.
+ * @param g a finite generator
+ * @return a list of the elements produced by {@code g}
+ */
+template <typename A>
+list<A> to_list( generator<A> g ) { return lazy_list<A>::copy( std::size_t( -1 ), lazy_list<A>::from( g ) ); }
+
+/**
+ * The {@code sum} function computes the sum of a finite generator of numbers without
+ * materialising it.
+ * @param g a finite generator
+ * @return the sum of each element produced by {@code g}
+ */
+template <typename A>
+A sum( generator<A> g )
+{
+    A result = 0;
+    for ( auto const& x : g ) { result += x; }
+    return result;
+}
+
+} // end namespace prelude
+
+#endif //HPP_PRELUDE_GENERATOR
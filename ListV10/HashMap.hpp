@@ -0,0 +1,377 @@
+#ifndef HPP_PRELUDE_HASH_MAP
+#define HPP_PRELUDE_HASH_MAP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+#include "List.hpp"
+#include "Maybe.hpp"
+
+/**
+ * Implementation of Haskell-like, functional programming idioms, particularly recursive lists.
+ */
+namespace prelude {
+
+/**
+ * Family of immutable finite maps implemented as hash array mapped tries (HAMT), in the
+ * compressed (CHAMP) layout: each node consumes 5 bits of the key's hash and keeps two
+ * 32-bit bitmaps, one for entries stored inline and one for child nodes, each backed by a
+ * dense array. Lookup, insertion and deletion are O(log32 n) and copy only the nodes on
+ * the path to the key, so every version of a map shares all other nodes with the rest.
+ * Nodes are reference counted intrusively, as for {@code list<A>}; keys whose hashes
+ * collide in all bits are kept together in a collision node at the bottom of the trie.
+ *
+ * @author Matthew A Johnson
+ * @version 1.0
+ */
+template <typename K, typename V, typename H = std::hash<K>>
+class hash_map
+{
+    struct node;
+public:
+    using entry = std::pair<K, V>;
+
+    /**
+     * Constructs an empty map.
+     */
+    hash_map() : _root( nullptr ), _size( 0 ) {}
+    /**
+     * Constructs a map using standard uniform initialization; later entries replace earlier
+     * ones with the same key.
+     * @param es a comma-separated list of key-value pairs
+     */
+    hash_map( std::initializer_list<entry> es ) : hash_map()
+        { for ( auto const& e : es ) { *this = insert( e.first, e.second, *this ); } }
+    /**
+     * Makes a shallow copy of the specified map, sharing all of its nodes.
+     * @param m the existing map to be copied
+     */
+    hash_map( hash_map const& m ) : _root( acquire( m._root ) ), _size( m._size ) {}
+    /**
+     * Move-constructor for maps.
+     * @param m the r-value map to be moved
+     */
+    hash_map( hash_map && m ) noexcept : _root( m._root ), _size( m._size ) { m._root = nullptr; m._size = 0; }
+    /**
+     * Destroys this map and any referenced nodes for which this map was sole owner.
+     */
+    ~hash_map() { release( _root ); }
+    /**
+     * Copy-assignment of maps (shallow).
+     * @param m the existing map to be copied
+     */
+    hash_map& operator= ( hash_map const& m )
+        { if ( _root != m._root ) { release( _root ); _root = acquire( m._root ); } _size = m._size; return *this; }
+    /**
+     * Move-assignment of maps.
+     * @param m the r-value map to be moved
+     */
+    hash_map& operator= ( hash_map && m ) noexcept
+        { std::swap( _root, m._root ); std::swap( _size, m._size ); return *this; }
+
+    /**
+     * Casting operator permits type-conversion from map to boolean for use in test expressions.
+     */
+    explicit operator bool() const { return _size != 0; }
+
+private:
+    static constexpr unsigned BITS = 5;
+    static constexpr unsigned HASH_BITS = 8 * sizeof( std::size_t );
+
+    /**
+     * Internal reference-counting trie node. A node below the last level of hash bits is a
+     * collision node: both bitmaps are unused and {@code _entries} is searched linearly.
+     */
+    struct node
+    {
+        node() : _refs( 0 ), _datamap( 0 ), _nodemap( 0 ) {}
+        node( node const& n )
+            : _refs( 0 ), _datamap( n._datamap ), _nodemap( n._nodemap ), _entries( n._entries ), _kids( n._kids )
+            { for ( auto k : _kids ) { acquire( k ); } }
+        ~node() { for ( auto k : _kids ) { release( k ); } }
+
+        /** Counter for tracking references to this node. */
+        std::size_t        _refs;
+        /** Hash fragments with an entry stored inline. */
+        std::uint32_t      _datamap;
+        /** Hash fragments with a child node. */
+        std::uint32_t      _nodemap;
+        /** Inline entries, in order of their hash fragments. */
+        std::vector<entry> _entries;
+        /** Children, in order of their hash fragments. */
+        std::vector<node*> _kids;
+    };
+
+    node*       _root;
+    std::size_t _size;
+
+    static node* acquire( node* n ) { if ( n ) { ++(n->_refs); } return n; }
+    static void  release( node* n ) { if ( n && !--(n->_refs) ) { delete n; } }
+
+    static std::size_t hash( K const& k ) { return H()( k ); }
+    static std::uint32_t bit( std::size_t h, unsigned shift ) { return 1u << ( ( h >> shift ) & 31 ); }
+    static unsigned index( std::uint32_t map, std::uint32_t b ) { return __builtin_popcount( map & ( b - 1 ) ); }
+
+    static V const* find( node const* n, K const& k, std::size_t h )
+    {
+        for ( unsigned shift = 0; n; shift += BITS ) {
+            if ( shift >= HASH_BITS ) {
+                for ( auto const& e : n->_entries ) { if ( e.first == k ) { return &e.second; } }
+                return nullptr;
+            }
+            auto b = bit( h, shift );
+            if ( n->_datamap & b ) {
+                auto const& e = n->_entries[index( n->_datamap, b )];
+                return e.first == k ? &e.second : nullptr;
+            }
+            if ( !( n->_nodemap & b ) ) { return nullptr; }
+            n = n->_kids[index( n->_nodemap, b )];
+        }
+        return nullptr;
+    }
+
+    /** Node holding two entries with distinct keys, split at the first differing hash fragment. */
+    static node* pair_node( entry e1, std::size_t h1, entry e2, std::size_t h2, unsigned shift )
+    {
+        auto n = new node();
+        if ( shift >= HASH_BITS ) {
+            n->_entries = { std::move( e1 ), std::move( e2 ) };
+            return n;
+        }
+        auto b1 = bit( h1, shift ), b2 = bit( h2, shift );
+        if ( b1 == b2 ) {
+            n->_nodemap = b1;
+            n->_kids.push_back( acquire( pair_node( std::move( e1 ), h1, std::move( e2 ), h2, shift + BITS ) ) );
+        } else {
+            n->_datamap = b1 | b2;
+            if ( b1 < b2 ) {
+                n->_entries = { std::move( e1 ), std::move( e2 ) };
+            } else {
+                n->_entries = { std::move( e2 ), std::move( e1 ) };
+            }
+        }
+        return n;
+    }
+
+    /** Path-copying insertion; sets {@code added} if the key was not already present. */
+    static node* assoc( node const* n, entry e, std::size_t h, unsigned shift, bool& added )
+    {
+        auto m = n ? new node( *n ) : new node();
+        if ( shift >= HASH_BITS ) {
+            for ( auto& f : m->_entries ) {
+                if ( f.first == e.first ) { f.second = std::move( e.second ); return m; }
+            }
+            m->_entries.push_back( std::move( e ) );
+            added = true;
+            return m;
+        }
+        auto b = bit( h, shift );
+        if ( m->_datamap & b ) {
+            auto i = index( m->_datamap, b );
+            if ( m->_entries[i].first == e.first ) {
+                m->_entries[i].second = std::move( e.second );
+                return m;
+            }
+            auto old = std::move( m->_entries[i] );
+            m->_entries.erase( m->_entries.begin() + i );
+            m->_datamap ^= b;
+            auto oh = hash( old.first );
+            auto kid = pair_node( std::move( old ), oh, std::move( e ), h, shift + BITS );
+            m->_nodemap |= b;
+            m->_kids.insert( m->_kids.begin() + index( m->_nodemap, b ), acquire( kid ) );
+            added = true;
+        } else if ( m->_nodemap & b ) {
+            auto i = index( m->_nodemap, b );
+            auto kid = acquire( assoc( m->_kids[i], std::move( e ), h, shift + BITS, added ) );
+            release( m->_kids[i] );
+            m->_kids[i] = kid;
+        } else {
+            m->_datamap |= b;
+            m->_entries.insert( m->_entries.begin() + index( m->_datamap, b ), std::move( e ) );
+            added = true;
+        }
+        return m;
+    }
+
+    /**
+     * Path-copying deletion; returns {@code n} itself if the key is absent. A child left with a
+     * single entry and no children is folded back into its parent, keeping the trie canonical.
+     */
+    static node const* dissoc( node const* n, K const& k, std::size_t h, unsigned shift )
+    {
+        if ( shift >= HASH_BITS ) {
+            for ( std::size_t i = 0; i < n->_entries.size(); ++i ) {
+                if ( n->_entries[i].first == k ) {
+                    auto m = new node( *n );
+                    m->_entries.erase( m->_entries.begin() + i );
+                    return m;
+                }
+            }
+            return n;
+        }
+        auto b = bit( h, shift );
+        if ( n->_datamap & b ) {
+            auto i = index( n->_datamap, b );
+            if ( !( n->_entries[i].first == k ) ) { return n; }
+            auto m = new node( *n );
+            m->_entries.erase( m->_entries.begin() + i );
+            m->_datamap ^= b;
+            return m;
+        }
+        if ( !( n->_nodemap & b ) ) { return n; }
+        auto i = index( n->_nodemap, b );
+        auto kid = n->_kids[i];
+        auto nk = dissoc( kid, k, h, shift + BITS );
+        if ( nk == kid ) { return n; }
+        auto m = new node( *n );
+        if ( nk->_kids.empty() && nk->_entries.size() == 1 ) {
+            // Inline the remaining entry in place of the child.
+            auto e = nk->_entries[0];
+            delete nk;
+            release( m->_kids[i] );
+            m->_kids.erase( m->_kids.begin() + i );
+            m->_nodemap ^= b;
+            m->_datamap |= b;
+            m->_entries.insert( m->_entries.begin() + index( m->_datamap, b ), std::move( e ) );
+        } else {
+            release( m->_kids[i] );
+            m->_kids[i] = acquire( const_cast<node*>( nk ) );
+        }
+        return m;
+    }
+
+    template <typename F>
+    static void each( node const* n, F& f )
+    {
+        if ( !n ) { return; }
+        for ( auto const& e : n->_entries ) { f( e ); }
+        for ( auto k : n->_kids ) { each( k, f ); }
+    }
+
+    template <typename L, typename W, typename G> friend std::size_t length( hash_map<L,W,G> const& );
+    template <typename L, typename W, typename G> friend maybe<W> lookup( L const&, hash_map<L,W,G> const& );
+    template <typename L, typename W, typename G> friend hash_map<L,W,G> insert( L, W, hash_map<L,W,G> const& );
+    template <typename L, typename W, typename G> friend hash_map<L,W,G> erase( L const&, hash_map<L,W,G> const& );
+    template <typename L, typename W, typename G> friend list<std::pair<L,W>> to_list( hash_map<L,W,G> const& );
+};
+
+/**
+ * Test whether a map is empty.
+ * @param m a map
+ * @return true if {@code m} has no entries, false otherwise
+ */
+template <typename K, typename V, typename H>
+inline bool null( hash_map<K,V,H> const& m ) { return !m; }
+
+/**
+ * Returns the number of entries in a map. This operation has time complexity O(1).
+ * @param m a map
+ * @return the number of keys in {@code m}
+ */
+template <typename K, typename V, typename H>
+inline std::size_t length( hash_map<K,V,H> const& m ) { return m._size; }
+
+/**
+ * Looks up the value associated with a key, in O(log32 n).
+ * @param k a key
+ * @param m a map
+ * @return the value associated with {@code k} in {@code m}, or nothing
+ */
+template <typename K, typename V, typename H>
+inline maybe<V> lookup( K const& k, hash_map<K,V,H> const& m )
+{
+    auto v = hash_map<K,V,H>::find( m._root, k, hash_map<K,V,H>::hash( k ) );
+    if ( v ) { return just( *v ); }
+    return nothing<V>();
+}
+
+/**
+ * Tests whether a map has an entry for a key.
+ * @param k a key
+ * @param m a map
+ * @return true if {@code k} is a key of {@code m}
+ */
+template <typename K, typename V, typename H>
+inline bool member( K const& k, hash_map<K,V,H> const& m ) { return lookup( k, m ).has_value(); }
+
+/**
+ * Gets a map with an entry added or replaced, in O(log32 n).
+ * @param k a key
+ * @param v a value
+ * @param m a map
+ * @return a map associating {@code k} with {@code v} and otherwise the same as {@code m}
+ */
+template <typename K, typename V, typename H>
+inline hash_map<K,V,H> insert( K k, V v, hash_map<K,V,H> const& m )
+{
+    using map = hash_map<K,V,H>;
+
+    bool added = false;
+    auto h = map::hash( k );
+    map n;
+    n._root = map::acquire( map::assoc( m._root, { std::move( k ), std::move( v ) }, h, 0, added ) );
+    n._size = m._size + ( added ? 1 : 0 );
+    return n;
+}
+
+/**
+ * Gets a map without the entry for a key, in O(log32 n).
+ * @param k a key
+ * @param m a map
+ * @return a map without {@code k} and otherwise the same as {@code m}
+ */
+template <typename K, typename V, typename H>
+inline hash_map<K,V,H> erase( K const& k, hash_map<K,V,H> const& m )
+{
+    using map = hash_map<K,V,H>;
+    using node = typename map::node;
+
+    if ( !m._root ) { return m; }
+    auto r = map::dissoc( m._root, k, map::hash( k ), 0 );
+    if ( r == m._root ) { return m; }
+    map n;
+    n._size = m._size - 1;
+    if ( n._size ) { n._root = map::acquire( const_cast<node*>( r ) ); } else { delete r; }
+    return n;
+}
+
+/**
+ * Lists the entries of a map, in unspecified order.
+ * @param m a map
+ * @return a list of the key-value pairs of {@code m}
+ */
+template <typename K, typename V, typename H>
+inline list<std::pair<K,V>> to_list( hash_map<K,V,H> const& m )
+{
+    std::vector<std::pair<K,V>> es;
+    es.reserve( m._size );
+    auto push = [&es]( std::pair<K,V> const& e ){ es.push_back( e ); };
+    hash_map<K,V,H>::each( m._root, push );
+    auto xs = empty<std::pair<K,V>>();
+    for ( auto i = es.rbegin(); i != es.rend(); ++i ) { xs = *i | xs; }
+    return xs;
+}
+
+/**
+ * Builds a map from an association list; later pairs replace earlier ones with the same key.
+ * @param xs a list of key-value pairs
+ * @return a map with the entries of {@code xs}
+ */
+template <typename K, typename V, typename H = std::hash<K>>
+inline hash_map<K,V,H> from_list( list<std::pair<K,V>> xs )
+{
+    hash_map<K,V,H> m;
+    for ( ; !null( xs ); xs = tail( xs ) ) {
+        auto e = head( xs );
+        m = insert( std::move( e.first ), std::move( e.second ), m );
+    }
+    return m;
+}
+
+} // end namespace prelude
+
+#endif //HPP_PRELUDE_HASH_MAP
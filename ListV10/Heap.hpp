@@ -0,0 +1,262 @@
+#ifndef HPP_PRELUDE_HEAP
+#define HPP_PRELUDE_HEAP
+
+#include <cstddef>
+#include <ostream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "List.hpp"
+
+/**
+ * Implementation of Haskell-like, functional programming idioms, particularly recursive lists.
+ */
+namespace prelude {
+
+/**
+ * A node of a leftist tree: an element, the rank of the tree and its left sub-tree. The node
+ * is kept as the head of a list node whose tail is the right sub-tree, so a tree's right
+ * spine is a list and heaps are built from the same intrusive, reference-counted nodes as
+ * lists. For internal use only.
+ */
+template <typename A>
+struct _leftist
+{
+    A      _top;
+    // Length of the right spine of the tree rooted here; never less than that of the left sub-tree.
+    size_t _rank;
+    // Mutable only so that the destructor may dismantle sub-trees of a node it solely owns.
+    mutable list<_leftist> _left;
+
+    _leftist( A top, size_t rank, list<_leftist> left ) : _top( std::move( top ) ), _rank( rank ), _left( std::move( left ) ) {}
+    _leftist( _leftist const& ) = default;
+    _leftist( _leftist && ) = default;
+
+    /**
+     * Destroys this tree and any sub-trees it solely owns, iteratively: inserting decreasing
+     * elements makes a left spine as long as the heap is large, too deep for recursive destruction.
+     */
+    ~_leftist()
+    {
+        using node = _list_node<_leftist>;
+        auto n = _left._rep;
+        _left._rep = nullptr;
+        if ( !n || --(n->_refs) ) { return; }
+        // n is now solely owned; follow one freed child directly and stack the other, so a
+        // chain of nodes is dismantled without allocating.
+        std::vector<node*> pending;
+        for ( ;; ) {
+            node* next = nullptr;
+            for ( auto c : { n->_head._left._rep, n->_tail } ) {
+                if ( !c || --(c->_refs) ) { continue; }
+                if ( next ) { pending.push_back( c ); } else { next = c; }
+            }
+            n->_head._left._rep = nullptr;
+            n->_tail = nullptr;
+            delete n;
+            if ( !next ) {
+                if ( pending.empty() ) { return; }
+                next = pending.back();
+                pending.pop_back();
+            }
+            n = next;
+        }
+    }
+};
+
+/**
+ * A leftist tree, as a list whose head is the root and whose tail is the right sub-tree;
+ * the empty list is the empty tree. For internal use only.
+ */
+template <typename A>
+using _heap_tree = list<_leftist<A>>;
+
+/** The rank of a leftist tree: the length of its right spine. */
+template <typename A>
+inline size_t _heap_rank( list_ref<_leftist<A>> t ) { return null( t ) ? 0 : head( t )._rank; }
+
+/** Makes a tree from a root and two sub-trees, putting the one of lesser rank on the right. */
+template <typename A>
+inline _heap_tree<A> _heap_node( A const& x, _heap_tree<A> a, _heap_tree<A> b )
+{
+    auto ra = _heap_rank<A>( a ), rb = _heap_rank<A>( b );
+    if ( ra < rb ) { std::swap( a, b ); std::swap( ra, rb ); }
+    return _leftist<A>( x, rb + 1, std::move( a ) ) | std::move( b );
+}
+
+/**
+ * Merges two trees along their right spines, in O(log n) worst-case time: each spine is at
+ * most log2(n + 1) long, and only nodes on the spines are copied.
+ */
+template <typename A>
+inline _heap_tree<A> _heap_merge( _heap_tree<A> const& a, _heap_tree<A> const& b )
+{
+    if ( null( a ) ) { return b; }
+    if ( null( b ) ) { return a; }
+    if ( head( b )._top < head( a )._top ) { return _heap_merge( b, a ); }
+    auto const& x = head( a );
+    return _heap_node( x._top, x._left, _heap_merge( tail( a ), b ) );
+}
+
+/**
+ * Persistent min-heap (leftist heap). {@code findMin} is O(1); {@code insert}, {@code merge}
+ * and {@code deleteMin} are O(log n) in the worst case. The bounds are worst-case rather than
+ * amortised so that they hold under persistence: every version remains valid, versions share
+ * their trees, and a heap can be snapshotted by copying it and each copy used any number of
+ * times at the same cost. Elements are ordered by {@code operator<}.
+ *
+ * @author Matthew A Johnson
+ * @version 1.0
+ */
+template <typename A>
+class heap
+{
+public:
+    /**
+     * Constructs an empty heap.
+     */
+    heap() : _tree( empty<_leftist<A>>() ), _size( 0 ) {}
+
+private:
+    _heap_tree<A> _tree;
+    size_t        _size;
+
+    heap( _heap_tree<A> t, size_t n ) : _tree( std::move( t ) ), _size( n ) {}
+
+    template <typename B> friend heap<B> merge( heap<B> const&, heap<B> const& );
+    template <typename B> friend heap<B> insert( B, heap<B> const& );
+    template <typename B> friend B const& findMin( heap<B> const& );
+    template <typename B> friend heap<B> deleteMin( heap<B> const& );
+    template <typename B> friend size_t length( heap<B> const& );
+    template <typename B> friend heap<B> from_list( list_ref<B> );
+};
+
+/**
+ * Merges two heaps, in O(log n).
+ * @param h a heap
+ * @param g a heap
+ * @return a heap with the elements of both {@code h} and {@code g}
+ */
+template <typename A>
+inline heap<A> merge( heap<A> const& h, heap<A> const& g )
+{
+    return heap<A>( _heap_merge( h._tree, g._tree ), h._size + g._size );
+}
+
+/**
+ * Adds an element to a heap, in O(log n).
+ * @param x an element
+ * @param h a heap
+ * @return a heap with the elements of {@code h} and {@code x}
+ */
+template <typename A>
+inline heap<A> insert( A x, heap<A> const& h )
+{
+    return heap<A>( _heap_merge( _leftist<A>( std::move( x ), 1, empty<_leftist<A>>() ) | empty<_leftist<A>>(), h._tree ), h._size + 1 );
+}
+
+/**
+ * Gets the least element of a heap, which must be non-empty, in O(1).
+ * @param h a non-empty heap
+ * @return the least element of {@code h}
+ * @throws std::domain_error if {@code h} is empty
+ */
+template <typename A>
+inline A const& findMin( heap<A> const& h )
+{
+    if ( null( h._tree ) ) { PRELUDE_LIST_FAIL( "prelude::findMin: empty heap" ); }
+    return head( h._tree )._top;
+}
+
+/**
+ * Gets the least element of a temporary heap, which must be non-empty. The element is copied
+ * out, since the trees of {@code h} may be freed at the end of the full-expression.
+ * @param h a non-empty heap
+ * @return the least element of {@code h}
+ * @throws std::domain_error if {@code h} is empty
+ */
+template <typename A>
+inline A findMin( heap<A>&& h ) { return findMin( static_cast<heap<A> const&>( h ) ); }
+
+/**
+ * Removes the least element of a heap, which must be non-empty, in O(log n) by merging the
+ * sub-trees of the root.
+ * @param h a non-empty heap
+ * @return a heap with the elements of {@code h} except one occurrence of its least
+ * @throws std::domain_error if {@code h} is empty
+ */
+template <typename A>
+inline heap<A> deleteMin( heap<A> const& h )
+{
+    if ( null( h._tree ) ) { PRELUDE_LIST_FAIL( "prelude::deleteMin: empty heap" ); }
+    return heap<A>( _heap_merge( head( h._tree )._left, tail( h._tree ) ), h._size - 1 );
+}
+
+/**
+ * Returns the number of elements in a heap, in O(1).
+ * @param h a heap
+ * @return the number of elements in {@code h}
+ */
+template <typename A>
+inline size_t length( heap<A> const& h ) { return h._size; }
+
+/**
+ * Test whether a heap is empty.
+ * @param h a heap
+ * @return true if {@code h} is empty, false otherwise
+ */
+template <typename A>
+inline bool null( heap<A> const& h ) { return length( h ) == 0; }
+
+/**
+ * Builds a heap from a list in O(n), by merging trees in pairs, round after round.
+ * @param xs a finite list or list view
+ * @return a heap with the elements of {@code xs}
+ */
+template <typename A>
+inline heap<A> from_list( list_ref<A> xs )
+{
+    std::vector<_heap_tree<A>> ts;
+    for ( ; !null( xs ); xs = tail( xs ) ) { ts.push_back( _leftist<A>( head( xs ), 1, empty<_leftist<A>>() ) | empty<_leftist<A>>() ); }
+    auto n = ts.size();
+    while ( ts.size() > 1 ) {
+        size_t k = 0;
+        for ( size_t i = 0; i + 1 < ts.size(); i += 2 ) { ts[k++] = _heap_merge( ts[i], ts[i + 1] ); }
+        if ( ts.size() % 2 ) { ts[k++] = std::move( ts.back() ); }
+        ts.erase( ts.begin() + k, ts.end() );
+    }
+    return ts.empty() ? heap<A>() : heap<A>( std::move( ts[0] ), n );
+}
+
+/**
+ * Lists the elements of a heap in ascending order, by repeated {@code deleteMin}.
+ * @param h a heap
+ * @return a sorted list of the elements of {@code h}
+ */
+template <typename A>
+inline list<A> to_sorted_list( heap<A> h )
+{
+    std::vector<A> xs;
+    xs.reserve( length( h ) );
+    for ( ; !null( h ); h = deleteMin( h ) ) { xs.push_back( findMin( h ) ); }
+    auto ys = empty<A>();
+    for ( auto x = xs.rbegin(); x != xs.rend(); ++x ) { ys = std::move( *x ) | std::move( ys ); }
+    return ys;
+}
+
+/**
+ * Inserts a character string serialization of a heap, in ascending order, into an output stream.
+ * @param os an output stream
+ * @param h a heap
+ * @return a reference to the output stream
+ */
+template <typename A>
+std::ostream& operator<< ( std::ostream& os, heap<A> const& h )
+{
+    return os << to_sorted_list( h );
+}
+
+} // end namespace prelude
+
+#endif //HPP_PRELUDE_HEAP
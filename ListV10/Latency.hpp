@@ -0,0 +1,182 @@
+#ifndef HPP_PRELUDE_LATENCY
+#define HPP_PRELUDE_LATENCY
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+/**
+ * Implementation of Haskell-like, functional programming idioms, particularly recursive lists.
+ */
+namespace prelude {
+
+/**
+ * The list operations whose latencies are recorded when List.hpp is built with
+ * PRELUDE_LIST_LATENCY. {@code append} covers every overload of {@code +}, and
+ * {@code destroy} is the release of the last claim on a list.
+ */
+enum class list_op { cons, map, filter, append, take, drop, reverse, sum, length, destroy };
+
+/**
+ * Process-wide latency histograms, one per list operation and input length bucket.
+ * Input lengths are bucketed by powers of two ({@code [0]}, {@code [1]}, {@code [2,3]},
+ * {@code [4,7]}, ...). Latencies are recorded in nanoseconds in HDR-style log buckets:
+ * each power of two is split into {@code 1 << SUB_BITS} linear sub-buckets, so a
+ * reported percentile is within 1 / (1 << SUB_BITS) of the true value.
+ * Recording is lock-free (relaxed atomic increments).
+ */
+class latency_histograms
+{
+public:
+    static constexpr std::size_t OPS = 10;
+    static constexpr std::size_t LENGTHS = 33;
+    static constexpr unsigned SUB_BITS = 3;
+    static constexpr std::size_t SUBS = std::size_t( 1 ) << SUB_BITS;
+    static constexpr std::size_t BUCKETS = ( 64 - SUB_BITS + 1 ) * SUBS;
+
+    static latency_histograms& instance() { static latency_histograms h; return h; }
+
+    /**
+     * Records one call.
+     * @param op the operation
+     * @param n the length of the operation's input
+     * @param ns the latency of the call in nanoseconds
+     */
+    void record( list_op op, std::size_t n, std::uint64_t ns )
+    {
+        _counts[static_cast<std::size_t>( op )][length_bucket( n )][bucket( ns )].fetch_add( 1, std::memory_order_relaxed );
+    }
+
+    /**
+     * Gets a latency percentile.
+     * @param op the operation
+     * @param k the length bucket: inputs of length {@code 0} for {@code k == 0},
+     *        otherwise lengths in {@code [2^(k-1), 2^k)}
+     * @param q a quantile in {@code [0, 1]}
+     * @return the upper bound, in nanoseconds, of the bucket holding the {@code q}-quantile,
+     *         or zero if nothing was recorded
+     */
+    std::uint64_t percentile( list_op op, std::size_t k, double q ) const
+    {
+        auto const& h = _counts[static_cast<std::size_t>( op )][k];
+        auto total = count( op, k );
+        if ( total == 0 ) { return 0; }
+        auto rank = static_cast<std::uint64_t>( q * ( total - 1 ) ) + 1;
+        std::uint64_t seen = 0;
+        for ( std::size_t b = 0; b < BUCKETS; ++b ) {
+            seen += h[b].load( std::memory_order_relaxed );
+            if ( seen >= rank ) { return upper( b ); }
+        }
+        return upper( BUCKETS - 1 );
+    }
+
+    /**
+     * Gets the number of recorded calls.
+     * @param op the operation
+     * @param k the length bucket
+     * @return the number of calls of {@code op} recorded in length bucket {@code k}
+     */
+    std::uint64_t count( list_op op, std::size_t k ) const
+    {
+        std::uint64_t total = 0;
+        for ( auto const& c : _counts[static_cast<std::size_t>( op )][k] ) { total += c.load( std::memory_order_relaxed ); }
+        return total;
+    }
+
+    /**
+     * Writes one line per operation and non-empty length bucket: the operation, the largest
+     * input length in the bucket, the number of calls and their p50/p90/p99/p99.9/max
+     * latencies in nanoseconds.
+     * @param os an output stream
+     */
+    void dump( std::ostream& os ) const
+    {
+        static char const* const names[OPS] =
+            { "cons", "map", "filter", "append", "take", "drop", "reverse", "sum", "length", "destroy" };
+        os << "op\tlen<=\tcalls\tp50\tp90\tp99\tp99.9\tmax (ns)\n";
+        for ( std::size_t op = 0; op < OPS; ++op ) {
+            for ( std::size_t k = 0; k < LENGTHS; ++k ) {
+                auto o = static_cast<list_op>( op );
+                auto n = count( o, k );
+                if ( n == 0 ) { continue; }
+                os << names[op] << '\t' << ( k ? ( std::uint64_t( 1 ) << k ) - 1 : 0 ) << '\t' << n
+                   << '\t' << percentile( o, k, 0.5 ) << '\t' << percentile( o, k, 0.9 )
+                   << '\t' << percentile( o, k, 0.99 ) << '\t' << percentile( o, k, 0.999 )
+                   << '\t' << percentile( o, k, 1.0 ) << '\n';
+            }
+        }
+    }
+
+    /** Discards everything recorded so far. */
+    void reset()
+    {
+        for ( auto& op : _counts ) for ( auto& h : op ) for ( auto& c : h ) { c.store( 0, std::memory_order_relaxed ); }
+    }
+
+private:
+    latency_histograms() : _counts() {}
+
+    static unsigned log2( std::uint64_t v ) { unsigned e = 0; while ( v >>= 1 ) { ++e; } return e; }
+
+    static std::size_t length_bucket( std::size_t n )
+    {
+        return n ? std::min<std::size_t>( log2( n ) + 1, LENGTHS - 1 ) : 0;
+    }
+    static std::size_t bucket( std::uint64_t v )
+    {
+        if ( v < SUBS ) { return v; }
+        auto e = log2( v );
+        return ( e - SUB_BITS + 1 ) * SUBS + ( ( v >> ( e - SUB_BITS ) ) - SUBS );
+    }
+    /** The largest value falling in bucket {@code b}. */
+    static std::uint64_t upper( std::size_t b )
+    {
+        if ( b < SUBS ) { return b; }
+        auto e = b / SUBS + SUB_BITS - 1;
+        auto sub = b % SUBS + SUBS;
+        return ( ( sub + 1 ) << ( e - SUB_BITS ) ) - 1;
+    }
+
+    std::array<std::array<std::array<std::atomic<std::uint64_t>, BUCKETS>, LENGTHS>, OPS> _counts;
+};
+
+/**
+ * Writes the recorded list operation latencies to a stream.
+ * @param os an output stream
+ */
+inline void latency_dump( std::ostream& os ) { latency_histograms::instance().dump( os ); }
+
+/**
+ * Discards the recorded list operation latencies.
+ */
+inline void latency_reset() { latency_histograms::instance().reset(); }
+
+/**
+ * Scope timer recording the latency of one list operation when it goes out of scope.
+ * For internal use only.
+ */
+class _latency_probe
+{
+public:
+    _latency_probe( list_op op, std::size_t n ) : _op( op ), _n( n ), _start( std::chrono::steady_clock::now() ) {}
+    ~_latency_probe()
+    {
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now() - _start ).count();
+        latency_histograms::instance().record( _op, _n, static_cast<std::uint64_t>( ns ) );
+    }
+    _latency_probe( _latency_probe const& ) = delete;
+    _latency_probe& operator= ( _latency_probe const& ) = delete;
+
+private:
+    list_op _op;
+    std::size_t _n;
+    std::chrono::steady_clock::time_point _start;
+};
+
+} // end namespace prelude
+
+#endif //HPP_PRELUDE_LATENCY
@@ -1,53 +1,157 @@
 #ifndef HPP_PRELUDE_LIST
 #define HPP_PRELUDE_LIST
 
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <new>
 #include <ostream>
 #include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+#ifdef PRELUDE_LIST_ATOMIC_REFS
+#include <atomic>
+#endif
+
+#include "BasicList.hpp"
+#include "Maybe.hpp"
+
+// Latency keys need the input length of every probed call, so latency builds memoise lengths.
+#if defined( PRELUDE_LIST_LATENCY ) && !defined( PRELUDE_LIST_MEMO_LENGTH )
+#define PRELUDE_LIST_MEMO_LENGTH
+#endif
+
+// Exception-free builds: partial functions applied outside their domain abort rather than
+// throw, and the accessors that can then no longer fail are declared noexcept.
+#ifdef PRELUDE_LIST_NOEXCEPT
+#include <cstdio>
+#include <cstdlib>
+#define PRELUDE_LIST_NOTHROW noexcept
+#define PRELUDE_LIST_FAIL( what ) ( std::fputs( what "\n", stderr ), std::abort() )
+#else
+#define PRELUDE_LIST_NOTHROW
+#define PRELUDE_LIST_FAIL( what ) throw std::domain_error( what )
+#endif
+
+#ifdef PRELUDE_LIST_LATENCY
+#include "Latency.hpp"
+// Times the rest of the enclosing scope as one call of {@code op} on an input of length {@code n}.
+#define PRELUDE_LIST_PROBE( op, n ) _latency_probe _probe( list_op::op, n )
+#else
+#define PRELUDE_LIST_PROBE( op, n ) ((void) 0)
+#endif
 
 /**
  * Implementation of Haskell-like, functional programming idioms, particularly recursive lists.
  */
 namespace prelude {
 
+/**
+ * The list type: the member of the {@code basic_list} family that counts references inside
+ * each node and allocates nodes with {@code new}, specialised below.
+ */
+template <typename A> using list = basic_list<A, intrusive_ownership, new_alloc>;
+template <typename A> class list_ref;
+template <typename A> class atomic_list;
+template <typename A> class shared_list;
+template <typename A> class epoch_view;
+template <typename A> class dlist;
+template <typename A> class lazy_list;
+template <typename A> struct _leftist;
+
+template <typename A> struct _list_node;
+
+/**
+ * Non-owning view of a list, for inspection and traversal without reference counting.
+ * Every list is a {@code list_ref} of its own nodes, so the read-only functions ({@code null},
+ * {@code head}, {@code last}, {@code length}, {@code foldl}, {@code sum}, {@code elem}, ...)
+ * take a view and are handed a list without touching any reference count, which matters
+ * when counts are atomic (PRELUDE_LIST_ATOMIC_REFS). Traversing a view with {@code tail}
+ * yields further views; functions that keep structure ({@code cons}, {@code init} and
+ * {@code tail} on a list) still take and produce lists.
+ * A view is valid only while some list that owns its nodes is alive.
+ *
+ * @author Matthew A Johnson
+ * @version 1.0
+ */
+template <typename A>
+class list_ref
+{
+public:
+    /**
+     * Makes an owning list sharing the viewed nodes.
+     * @return a list with the same elements as this view
+     */
+    list<A> own() const;
+
+protected:
+    // Pointer to the first viewed node, or nullptr when the view is empty.
+    _list_node<A>* _rep;
+
+    /**
+     * Constructs a view of the nodes from {@code n} onwards. For internal use only.
+     */
+    explicit list_ref( _list_node<A>* n ) : _rep( n ) {}
+
+    template <typename B> friend bool null( list_ref<B> ) PRELUDE_LIST_NOTHROW;
+    template <typename B> friend B const& head( list_ref<B> ) PRELUDE_LIST_NOTHROW;
+    template <typename B> friend list_ref<B> tail( list_ref<B> ) PRELUDE_LIST_NOTHROW;
+    template <typename B> friend B const& last( list_ref<B> ) PRELUDE_LIST_NOTHROW;
+    template <typename B> friend list<B> init( list_ref<B> );
+    template <typename B> friend size_t length( list_ref<B> );
+    template <typename F, typename B, typename C> friend B foldl( F, B, list_ref<C> );
+    template <typename B> friend B sum( list_ref<B> );
+    template <typename B> friend bool elem( B const&, list_ref<B> );
+};
+
 /**
  * Family of immutable, recursively-defined, homogeneous list types.
  * Lists create via constructor or the cons operator (overloaded |) use
  * shallow copy for the tail, which helps ease the storage burden for
  * memory-heavy element types.
+ * This is {@code list<A>}, the {@code basic_list} with intrusive ownership and {@code new}
+ * allocation; its operations are the ones below rather than BasicList.hpp's generic ones.
  * 
  * @author Matthew A Johnson
  * @version 1.0
  */
 template <typename A>
-class list
+class basic_list<A, intrusive_ownership, new_alloc> : public list_ref<A>
 {
-    struct node;
+    using node = _list_node<A>;
     /** Class-scoped constant provided for empty list. */
-    static list const EMPTY;
+    static basic_list const EMPTY;
 public:
+    /**
+     * Constructs an empty list (internal pointer is null), as for any {@code basic_list};
+     * the global {@code empty} function returns a shared constant instead.
+     */
+    basic_list() : list_ref<A>( nullptr ) {}
     /**
      * Constructs a singleton list containing the specified element.
      * @param x the element to be stored in this list
      */
-    list( A x ) : list( x, EMPTY )  {}
+    basic_list( A x ) : basic_list( x, EMPTY )  {}
     /**
      * Makes a shallow copy of the specified list. This version shares ownership of
      * the internal node structure, increasing the reference count.
      * Note that deep copies are not permitted via the public interface for lists.
      * @param xs the existing list to be copied
      */
-    list( list const& xs ) : _rep( acquire( xs._rep ) ) {}
+    basic_list( basic_list const& xs ) : list_ref<A>( acquire( xs._rep ) ) {}
     /**
      * Move-constructor for lists. This version swaps the internal pointers while avoiding
      * unnecessary net-zero changes to the reference counts.
      * @param xs the r-value list to be moved
      */
-    list( list && xs ) noexcept : _rep( xs._rep ) { xs._rep = nullptr; }
+    basic_list( basic_list && xs ) noexcept : list_ref<A>( xs._rep ) { xs._rep = nullptr; }
     /**
      * Constructs a finite list using standard uniform initialization.
      * @param xs a comma-separated list of values that will be elements of this list
      */
-    list( std::initializer_list<A> xs ) : _rep( nullptr )
+    basic_list( std::initializer_list<A> xs ) : list_ref<A>( nullptr )
         {
             for (auto i = xs.end(); i-- != xs.begin();) {
                 _rep = acquire( new node(*i, _rep) );
@@ -56,46 +160,60 @@ public:
     /**
      * Destroys this list and any referenced nodes for which this list was sole owner.
      */
-    ~list() { release( _rep ); }
+    ~basic_list() { unclaim( _rep ); }
     /**
      * Copy-assignment of lists. Performs a shallow copy while sharing ownership of the
      * internal node structure and incrementing its reference count.
      * @param xs the existing list to be copied
      */
-    list& operator= ( list const& xs )
-        { if ( _rep != xs._rep ) { release( _rep ); _rep = acquire( xs._rep ); } return *this; }
+    basic_list& operator= ( basic_list const& xs )
+        { if ( _rep != xs._rep ) { unclaim( _rep ); _rep = acquire( xs._rep ); } return *this; }
     /**
      * Move-assignment of lists. This version effectively swaps the internal node pointers,
      * decrementing the LHS reference count without incrementing the RHS reference count.
      * @param xs the r-value list to be moved
      */
-    list& operator= ( list && xs )
-        { release( _rep ); _rep = xs._rep; xs._rep = nullptr; return *this; }
+    basic_list& operator= ( basic_list && xs )
+        { unclaim( _rep ); _rep = xs._rep; xs._rep = nullptr; return *this; }
     /**
      * Casting operator permits type-conversion from list to boolean for use in test expressions.
      */
     explicit operator bool() { return static_cast<bool>(_rep); }
+    /**
+     * Gets the element at the specified position of this list.
+     * When suffix lengths are memoised the bounds check is O(1); otherwise
+     * it is discovered during the O(i) traversal.
+     * @param i a zero-based index
+     * @return the element at position {@code i}
+     * @throws std::domain_error if {@code i} is not less than the length of this list
+     */
+    A const& operator[] ( size_t i ) const PRELUDE_LIST_NOTHROW
+    {
+#ifdef PRELUDE_LIST_MEMO_LENGTH
+        if ( i >= size_of( _rep ) ) { PRELUDE_LIST_FAIL( "prelude::[]: index too large" ); }
+#endif
+        auto to = _rep;
+        while ( to && i-- ) { to = to->_tail; }
+        if ( !to ) { PRELUDE_LIST_FAIL( "prelude::[]: index too large" ); }
+        return to->_head;
+    }
 
 private:
     // Pointer to internal, reference-counting node structure representation.
-    node* _rep;
+    using list_ref<A>::_rep;
     /**
      * `Cons`-constructor, copying version, for internal use only.
      */
-    list( A x, list const& xs ) : _rep( acquire( new node( x, xs._rep ) ) ) {}
+    basic_list( A x, basic_list const& xs ) : list_ref<A>( acquire( new node( x, xs._rep ) ) ) {}
     /**
      * `Cons`-constructor, move version, for internal use only.
      */
-    list( A x, list && xs ) : _rep( acquire( new node( std::move( x ) ) ) ) { _rep->_tail = xs._rep; xs._rep = nullptr; }
+    basic_list( A x, basic_list && xs ) : list_ref<A>( acquire( new node( std::move( x ) ) ) )
+        { _rep->_tail = xs._rep; xs._rep = nullptr; seal( _rep, _rep ); }
     /**
      * Constructs a list from a raw pointer to a node structure. For internal use only.
      */
-    list( node* n ) : _rep( acquire( n ) ) {}
-    /**
-     * Constructs an empty list (internal pointer is null). For internal use only;
-     * the global {@code empty} function is provided for general usage.
-     */
-    list() : _rep( nullptr ) {}
+    basic_list( node* n ) : list_ref<A>( acquire( n ) ) {}
 
     /**
      * Auxiliary function for incrementing a pointed-to node's reference count.
@@ -103,55 +221,82 @@ private:
     static node* acquire( node* n ) { if ( n ) { ++(n->_refs); } return n; }
     /**
      * Auxiliary function for decrementing a node's reference count and deleting if necessary.
+     * Iterates down the tail rather than recursing through the node destructor, so dropping the
+     * last claim on a long list (e.g., a deferred release in atomic_list) cannot overflow the stack.
      */
-    static node* release( node* n ) { if ( n ) { if ( !--(n->_refs) ) { delete n; } } return n; }
+    static void release( node* n )
+    {
+        while ( n && !--(n->_refs) ) {
+            auto next = n->_tail;
+            n->_tail = nullptr;
+            delete n;
+            n = next;
+        }
+    }
 
     /**
-     * Internal reference-counting node structure for a list.
-     * Required so that list can provide a distinct empty-list value (encapsulated nullptr).
+     * Auxiliary function dropping a list's claim on its first node, by destruction or by
+     * assignment. Under PRELUDE_LIST_LATENCY, dropping the last claim records a
+     * {@code destroy} probe, since that is when a long list is freed.
      */
-    struct node {};
-    struct finite_node : public node
+    static void unclaim( node* n )
     {
-        /**
-         * Make an internal list node from an element and a pointer to a node.
-         * @param x  an element
-         * @param xs pointer to an existing node (or nullptr)
-         */
-        explicit finite_node( A x, node* xs ) : _refs( 0 ), _head( x ), _tail( acquire( xs ) ) {}
-        /**
-         * Make an internal list node from an element and a pointer to a node.
-         * @param x  an element
-         * @param xs pointer to an existing node (or nullptr)
-         */
-        explicit finite_node( A x ) : _refs( 0 ), _head( x ), _tail( nullptr ) {}
-        /**
-         * Constructs a shallow copy of the given node, copying the head but sharing
-         * ownership of the tail with the original node.
-         * @param n an existing node to be copied
-         */
-        finite_node( finite_node const& n ) : _refs( 0 ), _head( n._head ), _tail( acquire( n._tail ) ) {}
-        /**
-         * Moves the given node to this one, transferring ownership of all resources.
-         * @param n an existing node to be moved
-         */
-        finite_node( finite_node && n ) noexcept
-            : _refs( n._refs ), _head( std::move( n._head ) ), _tail( n._tail ) { n._tail = nullptr; }
-
-        /** Destroy this element and relinquish a claim on the tail. */
-        ~finite_node() { release( _tail ); }
-
-        /** Counter for tracking references to this element. */
-        size_t  _refs;
-        /** The value of an element. */
-        A const _head;
-        /** node containing the next element. */
-        node*   _tail;
-    };
+#ifdef PRELUDE_LIST_LATENCY
+        if ( n && n->_refs == 1 ) { PRELUDE_LIST_PROBE( destroy, size_of( n ) ); release( n ); return; }
+#endif
+        release( n );
+    }
 
+    /**
+     * Auxiliary function giving the number of elements reachable from a node.
+     * O(1) when suffix lengths are memoised (PRELUDE_LIST_MEMO_LENGTH), O(n) otherwise.
+     */
+    static size_t size_of( node const* n )
+    {
+#ifdef PRELUDE_LIST_MEMO_LENGTH
+        return n ? n->_length : 0;
+#else
+        size_t k = 0;
+        for ( ; n; n = n->_tail ) { ++k; }
+        return k;
+#endif
+    }
+    /**
+     * Auxiliary function for recording suffix lengths on a chain of nodes built front-to-back,
+     * from {@code first} up to and including {@code last}, once the tail of {@code last} is fixed.
+     * Does nothing unless suffix lengths are memoised.
+     */
+    static void seal( node* first, node* last )
+    {
+#ifdef PRELUDE_LIST_MEMO_LENGTH
+        if ( !first ) { return; }
+        size_t k = 1;
+        for ( auto n = first; n != last; n = n->_tail ) { ++k; }
+        k += size_of( last->_tail );
+        for ( auto n = first; n != last->_tail; n = n->_tail ) { n->_length = k--; }
+#else
+        (void) first; (void) last;
+#endif
+    }
+
+    /**
+     * Node of a list whose tail is produced on demand by a generator of type {@code G}.
+     * Every node of such a list has this type, but only the last one produced so far holds
+     * the generator, so {@code _gen} is a variant member that is constructed and destroyed by
+     * hand as the generator moves down the list. For internal use only (see {@code lazy_list}).
+     */
     template <typename G>
     struct partial_node : public node
     {
+        partial_node( A x, G g ) : node( std::move( x ) ), _pending( true ) { new ( &_gen ) G( std::move( g ) ); }
+        partial_node( partial_node const& ) = delete;
+        ~partial_node() { settle(); }
+
+        /** Destroys the generator, once this node's tail is known or can never be. */
+        void settle() { if ( _pending ) { _gen.~G(); _pending = false; } }
+
+        // True while this node holds the generator and its tail is still to be produced.
+        bool _pending;
         union {
         G _gen;
         };
@@ -161,7 +306,7 @@ private:
      * @deprecated This function is not currently used and is likely to be removed in a future version.
      * Creates and returns a deep copy of this list.
      */
-    list clone()
+    basic_list clone()
 	{
   		auto zs = list<A>( this->_rep->_head );
 	  	auto from = this->_rep;
@@ -169,28 +314,22 @@ private:
   		while ( (from = from->_tail) ) {
     		to = to->_tail = list<A>::acquire( new typename list<A>::node( from->_head ) );
 	  	}
+        seal( zs._rep, to );
 		return zs;
     }
 
     // Friend privileges provided for optimal performance of core functions.
 
-    A& operator[] ( size_t i )
-    {
-        if ( !this->_rep ) { throw std::domain_error("prelude::[]: index too large"); }
-	    if ( i <  0 ) { throw std::domain_error("prelude::[]: negative index"); }
-        if ( i == 0 ) { return this->_rep->_head; }
-    	auto to = this->_rep;
-	    while ( i-- ) { // 0 -> skip and return head (but haven't checked null), 1 -> check null
-            if ( !to ) { throw std::domain_error("prelude::[]: index too large"); }
-            to = to->_tail;
-        }
-      	return to->_head;
-    }
-
+    template <typename B> friend class list_ref;
+    template <typename B> friend struct _list_node;
+    template <typename B> friend class atomic_list;
+    template <typename B> friend class shared_list;
+    template <typename B> friend class epoch_view;
+    template <typename B> friend list<B> to_list( dlist<B> const& );
+    template <typename B> friend class lazy_list;
+    template <typename B> friend struct _leftist;
     template <typename B> friend list<B> const& empty();
-    template <typename B> friend bool    null( list<B> );
-    template <typename B> friend B       head( list<B> );
-    template <typename B> friend list<B> tail( list<B> );
+    template <typename B> friend list<B> tail( list<B> const& ) PRELUDE_LIST_NOTHROW;
     template <typename B> friend list<B> cons( B, list<B> );
     template <typename B> friend list<B> operator| ( B, list<B> );
     template <typename B> friend list<B> operator+ ( list<B> const&, list<B> const& );
@@ -199,14 +338,105 @@ private:
     template <typename B> friend std::ostream& operator<< ( std::ostream& , list<B> const& );
     template <typename F, typename B> friend auto map( F f, list<B> const& xs ) -> list<decltype( f( head( xs ) ) )>;
     template <typename P, typename B> friend list<B> filter( P, list<B> const& );
-    template <typename B> friend B sum( list<B> const& );
-    template <typename B> friend size_t length( list<B> const& );
+    template <typename B> friend B sum( list_ref<B> );
+    template <typename B> friend list<B> init( list_ref<B> );
+    template <typename B> friend size_t length( list_ref<B> );
+    template <typename F, typename B> friend B foldl1( F, list<B> const& );
+    template <typename F, typename B, typename C> friend B foldr( F, B, list<C> const& );
+    template <typename F, typename B, typename C> friend list<B> scanl( F, B, list<C> const& );
+    template <typename F, typename B> friend B fold_parallel( F, B, list<B> const&, unsigned );
+    template <typename P, typename B> friend bool any( P, list<B> const& );
+    template <typename K, typename V> friend maybe<V> lookup( K const&, list<std::pair<K, V>> const& );
+    template <typename F, typename B> friend auto mapMaybe( F f, list<B> const& xs )
+        -> list<typename decltype( f( head( xs ) ) )::value_type>;
+    template <typename P, typename B> friend std::pair<list<B>, list<B>> partition( P, list<B> const& );
+    template <typename B, typename H> friend list<B> nub( list<B> const&, H );
+    template <typename E, typename B> friend list<list<B>> groupBy( E, list<B> const& );
+    template <typename F, typename B, typename H> friend auto group_on( F f, list<B> const& xs, H )
+        -> list<std::pair<decltype( f( head( xs ) ) ), list<B>>>;
+    template <typename F, typename B> friend list<B> sortOn( F, list<B> const& );
+    template <typename F, typename B, typename C> friend auto zipWith( F f, list<B> const& xs, list<C> const& ys )
+        -> list<decltype( f( head( xs ), head( ys ) ) )>;
+    template <typename B, typename C> friend std::pair<list<B>, list<C>> unzip( list<std::pair<B, C>> const& );
+    template <typename F, typename B> friend auto multi_sum( std::vector<F> const&, list<B> const& xs )
+        -> std::vector<decltype( std::declval<F&>()( head( xs ) ) )>;
+    template <typename P, typename B> friend std::vector<list<B>> multi_filter( std::vector<P> const&, list<B> const& );
     template <typename B> friend list<B> take( unsigned, list<B> const& );
     template <typename B> friend list<B> drop( unsigned, list<B> const& );
     template <typename B> friend bool operator== ( list<B> const&, list<B> const& );
     template <typename B> friend list<B> reverse( list<B> const& );
 };
 
+/**
+ * Internal reference-counting node structure for a list.
+ * Required so that list can provide a distinct empty-list value (encapsulated nullptr).
+ */
+template <typename A>
+struct _list_node
+{
+    /**
+     * Make an internal list node from an element and a pointer to a node.
+     * @param x  an element
+     * @param xs pointer to an existing node (or nullptr)
+     */
+    explicit _list_node( A x, _list_node* xs ) : _refs( 0 ), _head( x ), _tail( list<A>::acquire( xs ) )
+#ifdef PRELUDE_LIST_MEMO_LENGTH
+        , _length( 1 + list<A>::size_of( xs ) )
+#endif
+        {}
+    /**
+     * Make an internal list node from an element and a pointer to a node.
+     * @param x  an element
+     * @param xs pointer to an existing node (or nullptr)
+     */
+    explicit _list_node( A x ) : _refs( 0 ), _head( x ), _tail( nullptr )
+#ifdef PRELUDE_LIST_MEMO_LENGTH
+        , _length( 1 )
+#endif
+        {}
+    /**
+     * Constructs a shallow copy of the given node, copying the head but sharing
+     * ownership of the tail with the original node.
+     * @param n an existing node to be copied
+     */
+    _list_node( _list_node const& n ) : _refs( 0 ), _head( n._head ), _tail( list<A>::acquire( n._tail ) )
+#ifdef PRELUDE_LIST_MEMO_LENGTH
+        , _length( n._length )
+#endif
+        {}
+    /**
+     * Moves the given node to this one, transferring ownership of all resources.
+     * @param n an existing node to be moved
+     */
+    _list_node( _list_node && n ) noexcept
+        : _refs( static_cast<size_t>( n._refs ) ), _head( std::move( n._head ) ), _tail( n._tail )
+#ifdef PRELUDE_LIST_MEMO_LENGTH
+        , _length( n._length )
+#endif
+        { n._tail = nullptr; }
+
+    /** Destroy this element and relinquish a claim on the tail. */
+    ~_list_node() { list<A>::release( _tail ); }
+
+    /** Counter for tracking references to this element; atomic under PRELUDE_LIST_ATOMIC_REFS. */
+#ifdef PRELUDE_LIST_ATOMIC_REFS
+    std::atomic<size_t> _refs;
+#else
+    size_t  _refs;
+#endif
+    /** The value of an element. */
+    A const _head;
+    /** node containing the next element. */
+    _list_node* _tail;
+#ifdef PRELUDE_LIST_MEMO_LENGTH
+    /** Number of elements from this node to the end of the list; fixed once the tail is. */
+    size_t  _length;
+#endif
+};
+
+template <typename A>
+inline list<A> list_ref<A>::own() const { return list<A>( _rep ); }
+
 /** Typed empty list constant - class scoped. */
 template <typename A> list<A> const list<A>::EMPTY {};
 /** Typed empty list constant - namespace scoped. */
@@ -219,7 +449,7 @@ template <typename A> list<A> const& empty() { return list<A>::EMPTY; }
  * @return a list with {@code x} at the head and {@code xs} as the tail
  */
 template <typename A>
-inline list<A> cons( A x, list<A> xs ) { return list<A>( x, xs ); }
+inline list<A> cons( A x, list<A> xs ) { PRELUDE_LIST_PROBE( cons, list<A>::size_of( xs._rep ) ); return list<A>( x, xs ); }
 /**
  * Constructs a list by pre-pending an element to an existing list (operator version).
  * @param x an element
@@ -227,7 +457,7 @@ inline list<A> cons( A x, list<A> xs ) { return list<A>( x, xs ); }
  * @return a list with {@code x} at the head and {@code xs} as the tail
  */
 template <typename A>
-inline list<A> operator| ( A x, list<A> xs ) { return list<A>( x, xs ); }
+inline list<A> operator| ( A x, list<A> xs ) { PRELUDE_LIST_PROBE( cons, list<A>::size_of( xs._rep ) ); return list<A>( x, xs ); }
 
 // Fundamental list operations
 
@@ -244,6 +474,7 @@ inline list<A> operator| ( A x, list<A> xs ) { return list<A>( x, xs ); }
 template <typename F, typename A>
 inline auto map( F f, list<A> const& xs ) -> list<decltype( f( head( xs ) ) )>
 {
+    PRELUDE_LIST_PROBE( map, list<A>::size_of( xs._rep ) );
 	using B = decltype( f( head(xs) ) );
   	using node = typename list<B>::node;
 
@@ -255,6 +486,7 @@ inline auto map( F f, list<A> const& xs ) -> list<decltype( f( head( xs ) ) )>
   	while ( (from = from->_tail) ) {
     	to = to->_tail = list<B>::acquire( new node( f( from->_head ) ) );
   	}
+    list<B>::seal( ys._rep, to );
   	return ys;
 }
 
@@ -281,6 +513,7 @@ inline list<A> append( list<A> const& xs, list<A> const& ys )
 template <typename A>
 inline list<A> operator+ ( list<A> const& xs, list<A> const& ys )
 {
+    PRELUDE_LIST_PROBE( append, list<A>::size_of( xs._rep ) );
   	using node = typename list<A>::node;
 
     if ( null( xs ) ) { return ys; }
@@ -292,6 +525,7 @@ inline list<A> operator+ ( list<A> const& xs, list<A> const& ys )
     	to = to->_tail = list<A>::acquire( new node( from->_head ) );
   	}
     to->_tail = list<A>::acquire( ys._rep );
+    list<A>::seal( zs._rep, to );
   	return zs;
 }
 
@@ -307,12 +541,14 @@ inline list<A> operator+ ( list<A> const& xs, list<A> const& ys )
 template <typename A>
 inline list<A> operator+ ( list<A> && xs, list<A> const& ys )
 {
+    PRELUDE_LIST_PROBE( append, list<A>::size_of( xs._rep ) );
     if ( null( xs ) ) { return ys; }
 
   	auto zs = std::move( xs );
   	auto to = zs._rep;
   	while ( to->_tail ) { to = to->_tail; }
     to->_tail = list<A>::acquire( ys._rep );
+    list<A>::seal( zs._rep, to );
   	return zs;
 }
 
@@ -328,6 +564,7 @@ inline list<A> operator+ ( list<A> && xs, list<A> const& ys )
 template <typename A>
 inline list<A> operator+ ( list<A> && xs, list<A> && ys )
 {
+    PRELUDE_LIST_PROBE( append, list<A>::size_of( xs._rep ) );
     if ( null( xs ) ) { return ys; }
 
   	auto zs = std::move( xs );
@@ -335,6 +572,7 @@ inline list<A> operator+ ( list<A> && xs, list<A> && ys )
   	while ( to->_tail ) { to = to->_tail; }
     to->_tail = ys._rep;
     ys._rep = nullptr;
+    list<A>::seal( zs._rep, to );
   	return zs;
 }
 
@@ -348,6 +586,7 @@ inline list<A> operator+ ( list<A> && xs, list<A> && ys )
 template <typename P, typename A>
 inline list<A> filter( P pred, list<A> const& xs )
 {
+    PRELUDE_LIST_PROBE( filter, list<A>::size_of( xs._rep ) );
   	using node = typename list<A>::node;
 
 	list<A> ys;
@@ -364,20 +603,71 @@ inline list<A> filter( P pred, list<A> const& xs )
     	} 
     	from = from->_tail;
   	} 
+    list<A>::seal( ys._rep, to );
   	return ys;
 }
 
+/**
+ * Test whether a list is empty.
+ * @param xs a list or list view
+ * @return true if {@code xs} is empty, false otherwise
+ */
+template <typename A>
+inline bool null( list_ref<A> xs ) PRELUDE_LIST_NOTHROW { return !xs._rep; }
+
+/**
+ * Test whether a list is empty. Lists are {@code basic_list}s, so this overload keeps
+ * BasicList.hpp's generic {@code null} from being chosen over the view version.
+ * @param xs a list
+ * @return true if {@code xs} is empty, false otherwise
+ */
+template <typename A>
+inline bool null( list<A> const& xs ) PRELUDE_LIST_NOTHROW { return null( static_cast<list_ref<A> const&>( xs ) ); }
+
 /**
  * Extract the first element of a list, which must be non-empty.
+ * @param xs a non-empty list or list view
+ * @return the first element of {@code xs}, valid for as long as its nodes are owned
+ * @throws std::domain_error if {@code xs} is empty
+ */
+template <typename A>
+inline A const& head( list_ref<A> xs ) PRELUDE_LIST_NOTHROW
+{
+    if ( !xs._rep ) { PRELUDE_LIST_FAIL( "prelude::head: empty list" ); }
+    return xs._rep->_head;
+}
+
+/**
+ * Extract the first element of a temporary list, which must be non-empty. The element is
+ * copied out, since the nodes of {@code xs} may be freed at the end of the full-expression.
  * @param xs a non-empty list
  * @return the first element of {@code xs}
  * @throws std::domain_error if {@code xs} is empty
  */
 template <typename A>
-inline A head( list<A> xs )
+inline A head( list<A>&& xs ) PRELUDE_LIST_NOTHROW { return head( static_cast<list_ref<A> const&>( xs ) ); }
+
+/**
+ * Extract the first element of a list, which must be non-empty; as for {@code null}, this
+ * overload takes lists away from BasicList.hpp's generic {@code head}.
+ * @param xs a non-empty list
+ * @return the first element of {@code xs}, valid for as long as its nodes are owned
+ * @throws std::domain_error if {@code xs} is empty
+ */
+template <typename A>
+inline A const& head( list<A> const& xs ) PRELUDE_LIST_NOTHROW { return head( static_cast<list_ref<A> const&>( xs ) ); }
+
+/**
+ * Borrow the elements after the head of a list view, which must be non-empty.
+ * @param xs a non-empty list view
+ * @return a view of all but the first element of {@code xs}
+ * @throws std::domain_error if {@code xs} is empty
+ */
+template <typename A>
+inline list_ref<A> tail( list_ref<A> xs ) PRELUDE_LIST_NOTHROW
 {
-  if ( null( xs ) ) { throw std::domain_error("prelude::head: empty list"); }
-  return xs._rep->_head;
+    if ( !xs._rep ) { PRELUDE_LIST_FAIL( "prelude::tail: empty list" ); }
+    return list_ref<A>( xs._rep->_tail );
 }
 
 /**
@@ -387,77 +677,145 @@ inline A head( list<A> xs )
  * @throws std::domain_error if {@code xs} is empty
  */
 template <typename A>
-inline list<A> tail( list<A> xs )
+inline list<A> tail( list<A> const& xs ) PRELUDE_LIST_NOTHROW
 {
-  if ( null( xs ) ) { throw std::domain_error("prelude::tail: empty list"); }
+  if ( null( xs ) ) { PRELUDE_LIST_FAIL( "prelude::tail: empty list" ); }
   return list<A>( xs._rep->_tail );
 }
 
 /**
  * Extract the last element of a list, which must be finite and non-empty.
- * @param xs a non-empty list
- * @return the last element of {@code xs}
+ * @param xs a non-empty list or list view
+ * @return the last element of {@code xs}, valid for as long as its nodes are owned
  * @throws std::domain_error if {@code xs} is empty
  */
 template <typename A>
-inline A last( list<A> xs )
+inline A const& last( list_ref<A> xs ) PRELUDE_LIST_NOTHROW
 {
-  if ( null( xs ) ) { throw std::domain_error("prelude::last: empty list"); }
-
-  auto ys = tail( xs );
-  if ( null( ys ) ) {
-    return head( xs );
-  } else {
-    return last( ys );
-  }
+    auto e = xs._rep;
+    if ( !e ) { PRELUDE_LIST_FAIL( "prelude::last: empty list" ); }
+    while ( e->_tail ) { e = e->_tail; }
+    return e->_head;
 }
 
+/**
+ * Extract the last element of a temporary list, which must be finite and non-empty. The
+ * element is copied out, since the nodes of {@code xs} may be freed at the end of the
+ * full-expression.
+ * @param xs a non-empty list
+ * @return the last element of {@code xs}
+ * @throws std::domain_error if {@code xs} is empty
+ */
+template <typename A>
+inline A last( list<A>&& xs ) PRELUDE_LIST_NOTHROW { return last( static_cast<list_ref<A> const&>( xs ) ); }
+
 /**
  * Return all the elements of a list except the last one.
  * The list must be non-empty.
- * @param xs a non-empty list
+ * @param xs a non-empty list or list view
  * @return a list containing all but the last element of {@code xs}
  * @throws std::domain_error if {@code xs} is empty
  */
 template <typename A>
-inline list<A> init( list<A> xs )
+inline list<A> init( list_ref<A> xs )
 {
-  if ( null( xs ) ) { throw std::domain_error("prelude::init: empty list"); }
+    using node = typename list<A>::node;
 
-  auto ys = tail( xs );
-  if ( null( ys ) ) {
+    auto from = xs._rep;
+    if ( !from ) { PRELUDE_LIST_FAIL( "prelude::init: empty list" ); }
+    if ( !from->_tail ) { return empty<A>(); }
+
+    auto ys = list<A>( from->_head );
+    auto to = ys._rep;
+    while ( (from = from->_tail)->_tail ) {
+        to = to->_tail = list<A>::acquire( new node( from->_head ) );
+    }
+    list<A>::seal( ys._rep, to );
     return ys;
-  } else {
-    return head( xs ) | init( ys );
-  }
 }
 
+// Total accessors: these return nothing where their partial counterparts would throw
+
 /**
- * Test whether a list is empty.
+ * Extract the first element of a list, if there is one.
+ * @param xs a list or list view
+ * @return the first element of {@code xs}, or nothing if {@code xs} is empty
+ */
+template <typename A>
+inline maybe<A> headMay( list_ref<A> xs ) { return null( xs ) ? nothing<A>() : just( head( xs ) ); }
+
+/**
+ * Extract the elements after the head of a list, if there is one.
  * @param xs a list
- * @return true if {@code xs} is empty, false otherwise
+ * @return a list containing all but the first element of {@code xs}, or nothing if {@code xs} is empty
  */
 template <typename A>
-inline bool null( list<A> xs ) { return !xs; }
+inline maybe<list<A>> tailMay( list<A> const& xs ) { return null( xs ) ? nothing<list<A>>() : just( tail( xs ) ); }
 
 /**
- * Returns the length of a finite list as an int.
- * This operation has time complexity O(n).
+ * Extract the last element of a list, if there is one.
+ * @param xs a finite list or list view
+ * @return the last element of {@code xs}, or nothing if {@code xs} is empty
+ */
+template <typename A>
+inline maybe<A> lastMay( list_ref<A> xs ) { return null( xs ) ? nothing<A>() : just( last( xs ) ); }
+
+/**
+ * Return all the elements of a list except the last one, if there is one.
+ * @param xs a finite list or list view
+ * @return a list containing all but the last element of {@code xs}, or nothing if {@code xs} is empty
+ */
+template <typename A>
+inline maybe<list<A>> initMay( list_ref<A> xs ) { return null( xs ) ? nothing<list<A>>() : just( init( xs ) ); }
+
+/**
+ * Decompose a list into its head and tail, i.e.,
+ *     {@code uncons(x | xs) == just(std::make_pair(x, xs))}
  * @param xs a list
+ * @return the head and tail of {@code xs}, or nothing if {@code xs} is empty
+ */
+template <typename A>
+inline maybe<std::pair<A, list<A>>> uncons( list<A> const& xs )
+{
+    if ( null( xs ) ) { return nothing(); }
+    return std::make_pair( head( xs ), tail( xs ) );
+}
+
+/**
+ * Gets the element at a given position of a list, if there is one.
+ * @param xs a list or list view
+ * @param i a zero-based index
+ * @return the element at position {@code i} of {@code xs}, or nothing if {@code xs} is too short
+ */
+template <typename A>
+inline maybe<A> at( list_ref<A> xs, size_t i )
+{
+    for ( ; i > 0 && !null( xs ); --i ) { xs = tail( xs ); }
+    if ( null( xs ) ) { return nothing(); }
+    return head( xs );
+}
+
+/**
+ * Returns the length of a finite list.
+ * This operation has time complexity O(n), or O(1) when built with PRELUDE_LIST_MEMO_LENGTH.
+ * @param xs a list or list view
  * @return the number of elements in {@code xs}
  */
 template <typename A>
-inline size_t length( list<A> const& xs )
+inline size_t length( list_ref<A> xs )
 {
-    size_t n = 0;
-    auto e = xs._rep;
-    while ( e ) {
-        ++n;
-        e = e->_tail;
-    }
-    return n;
+    PRELUDE_LIST_PROBE( length, list<A>::size_of( xs._rep ) );
+    return list<A>::size_of( xs._rep );
 }
 
+/**
+ * Returns the length of a finite list, through the view version rather than BasicList.hpp's.
+ * @param xs a list
+ * @return the number of elements in {@code xs}
+ */
+template <typename A>
+inline size_t length( list<A> const& xs ) { return length( static_cast<list_ref<A> const&>( xs ) ); }
+
 /**
  * Reverses a list.
  * {@code reverse(xs)} returns the elements of {@code xs} in reverse order.
@@ -468,6 +826,7 @@ inline size_t length( list<A> const& xs )
 template <typename A>
 inline list<A> reverse( list<A> const& xs )
 {
+    PRELUDE_LIST_PROBE( reverse, list<A>::size_of( xs._rep ) );
   	using node = typename list<A>::node;
 
 	auto from = xs._rep;
@@ -482,16 +841,169 @@ inline list<A> reverse( list<A> const& xs )
   	return list<A>( to );
 }
 
+// Folds
+
+/**
+ * Left-associative fold of a list: reduces the list using a binary operator, from left to right.
+ *     {@code foldl(f, z, list(x1, x2, ..., xn)) == f(...f(f(z, x1), x2)..., xn)}
+ * Runs in a single iterative pass, so it is safe on lists of any length.
+ * @param f a binary operator taking the accumulator then an element
+ * @param z the starting value of the accumulator
+ * @param xs a finite list or list view
+ * @return the final value of the accumulator
+ */
+template <typename F, typename B, typename A>
+inline B foldl( F f, B z, list_ref<A> xs )
+{
+    for ( auto e = xs._rep; e; e = e->_tail ) {
+        z = f( std::move( z ), e->_head );
+    }
+    return z;
+}
+
+/**
+ * Left-associative fold of a list, through the view version rather than BasicList.hpp's.
+ * @param f a binary operator taking the accumulator then an element
+ * @param z the starting value of the accumulator
+ * @param xs a finite list
+ * @return the final value of the accumulator
+ */
+template <typename F, typename B, typename A>
+inline B foldl( F f, B z, list<A> const& xs ) { return foldl( std::move( f ), std::move( z ), static_cast<list_ref<A> const&>( xs ) ); }
+
+/**
+ * A variant of {@code foldl} that has no starting value, and thus must be applied to a
+ * non-empty list.
+ * @param f a binary operator
+ * @param xs a non-empty, finite list
+ * @return the result of folding the tail of {@code xs} with its head as starting value
+ * @throws std::domain_error if {@code xs} is empty
+ */
+template <typename F, typename A>
+inline A foldl1( F f, list<A> const& xs )
+{
+    auto e = xs._rep;
+    if ( !e ) { PRELUDE_LIST_FAIL( "prelude::foldl1: empty list" ); }
+    A z = e->_head;
+    while ( (e = e->_tail) ) {
+        z = f( std::move( z ), e->_head );
+    }
+    return z;
+}
+
+/**
+ * Right-associative fold of a list: reduces the list using a binary operator, from right to left.
+ *     {@code foldr(f, z, list(x1, x2, ..., xn)) == f(x1, f(x2, ... f(xn, z)...))}
+ * The elements are gathered in one pass and folded back to front, rather than by recursion,
+ * so it is safe on lists of any length.
+ * @param f a binary operator taking an element then the accumulator
+ * @param z the starting value of the accumulator
+ * @param xs a finite list
+ * @return the final value of the accumulator
+ */
+template <typename F, typename B, typename A>
+inline B foldr( F f, B z, list<A> const& xs )
+{
+    std::vector<A const*> es;
+    for ( auto e = xs._rep; e; e = e->_tail ) { es.push_back( &e->_head ); }
+    for ( auto i = es.rbegin(); i != es.rend(); ++i ) {
+        z = f( **i, std::move( z ) );
+    }
+    return z;
+}
+
+/**
+ * Lists the successive reduced values of a left fold.
+ *     {@code scanl(f, z, list(x1, x2, ...)) == list(z, f(z, x1), f(f(z, x1), x2), ...)}
+ * @param f a binary operator taking the accumulator then an element
+ * @param z the starting value of the accumulator
+ * @param xs a finite list
+ * @return a list of every intermediate accumulator, starting with {@code z}
+ * @note {@code last(scanl(f, z, xs)) == foldl(f, z, xs)}
+ */
+template <typename F, typename B, typename A>
+inline list<B> scanl( F f, B z, list<A> const& xs )
+{
+    using node = typename list<B>::node;
+
+    auto ys = list<B>( z );
+    auto to = ys._rep;
+    for ( auto e = xs._rep; e; e = e->_tail ) {
+        z = f( std::move( z ), e->_head );
+        to = to->_tail = list<B>::acquire( new node( z ) );
+    }
+    list<B>::seal( ys._rep, to );
+    return ys;
+}
+
+/**
+ * Maps each element of a list to a monoid and combines the results, using {@code +} as
+ * the monoid operation and a value-initialised result as its identity.
+ * @param f function that takes an element of {@code xs} and returns a monoid value
+ * @param xs a finite list
+ * @return the combination of {@code f} applied to every element of {@code xs}
+ */
+template <typename F, typename A>
+inline auto foldMap( F f, list<A> const& xs ) -> decltype( f( head( xs ) ) )
+{
+    using B = decltype( f( head( xs ) ) );
+    return foldl( [&f]( B acc, A const& x ){ return std::move( acc ) + f( x ); }, B{}, xs );
+}
+
+/**
+ * Folds a list with an associative operator in parallel. The list is cut into
+ * {@code chunks} contiguous runs in one pass; each run is folded from {@code z} on
+ * its own thread, and the partial results are combined pairwise in a balanced tree.
+ *     {@code fold_parallel(f, z, xs) == foldl(f, z, xs)} when {@code f} is associative
+ *     and {@code z} is its identity.
+ * @param f an associative binary operator
+ * @param z the identity of {@code f}
+ * @param xs a finite list
+ * @param chunks number of runs to fold concurrently (defaults to the hardware concurrency)
+ * @return the result of combining every element of {@code xs} with {@code f}
+ */
+template <typename F, typename A>
+inline A fold_parallel( F f, A z, list<A> const& xs, unsigned chunks = std::thread::hardware_concurrency() )
+{
+    using node = typename list<A>::node;
+
+    std::vector<node const*> es;
+    for ( auto e = xs._rep; e; e = e->_tail ) { es.push_back( e ); }
+    chunks = std::max( 1u, std::min<unsigned>( chunks, es.size() / 1024 + 1 ) );
+
+    std::vector<std::future<A>> parts;
+    for ( unsigned c = 0; c < chunks; ++c ) {
+        auto lo = es.size() * c / chunks, hi = es.size() * ( c + 1 ) / chunks;
+        parts.push_back( std::async( c + 1 < chunks ? std::launch::async : std::launch::deferred,
+            [&es, &f, z, lo, hi]{
+                A acc = z;
+                for ( auto i = lo; i < hi; ++i ) { acc = f( std::move( acc ), es[i]->_head ); }
+                return acc;
+            } ) );
+    }
+
+    std::vector<A> rs;
+    for ( auto& p : parts ) { rs.push_back( p.get() ); }
+    while ( rs.size() > 1 ) {
+        std::vector<A> next;
+        for ( std::size_t i = 0; i + 1 < rs.size(); i += 2 ) { next.push_back( f( rs[i], rs[i + 1] ) ); }
+        if ( rs.size() % 2 ) { next.push_back( rs.back() ); }
+        rs.swap( next );
+    }
+    return rs.front();
+}
+
 // Special folds
 
 /**
  * The {@code sum} function computes the sum of a finite list of numbers.
- * @param xs a list
+ * @param xs a list or list view
  * @return the sum of each element of {@code xs}
  */
 template <typename A>
-inline A sum( list<A> const& xs )
+inline A sum( list_ref<A> xs )
 {
+    PRELUDE_LIST_PROBE( sum, list<A>::size_of( xs._rep ) );
     A result = 0;
     auto e = xs._rep;
     while ( e ) {
@@ -501,6 +1013,594 @@ inline A sum( list<A> const& xs )
     return result;
 }
 
+/**
+ * The {@code sum} of a finite list, through the view version rather than BasicList.hpp's.
+ * @param xs a list
+ * @return the sum of each element of {@code xs}
+ */
+template <typename A>
+inline A sum( list<A> const& xs ) { return sum( static_cast<list_ref<A> const&>( xs ) ); }
+
+/**
+ * The {@code product} function computes the product of a finite list of numbers.
+ * @param xs a list
+ * @return the product of each element of {@code xs}
+ */
+template <typename A>
+inline A product( list<A> const& xs )
+{
+    return foldl( []( A acc, A const& x ){ return acc * x; }, A( 1 ), xs );
+}
+
+/**
+ * The largest element of a non-empty, finite list.
+ * @param xs a non-empty list
+ * @return the maximum element of {@code xs}
+ * @throws std::domain_error if {@code xs} is empty
+ */
+template <typename A>
+inline A maximum( list<A> const& xs )
+{
+    if ( null( xs ) ) { PRELUDE_LIST_FAIL( "prelude::maximum: empty list" ); }
+    return foldl1( []( A const& acc, A const& x ){ return acc < x ? x : acc; }, xs );
+}
+
+/**
+ * The least element of a non-empty, finite list.
+ * @param xs a non-empty list
+ * @return the minimum element of {@code xs}
+ * @throws std::domain_error if {@code xs} is empty
+ */
+template <typename A>
+inline A minimum( list<A> const& xs )
+{
+    if ( null( xs ) ) { PRELUDE_LIST_FAIL( "prelude::minimum: empty list" ); }
+    return foldl1( []( A const& acc, A const& x ){ return x < acc ? x : acc; }, xs );
+}
+
+/**
+ * Determines whether any element of a list satisfies a predicate; stops at the first that does.
+ * @param pred a predicate function
+ * @param xs a list
+ * @return true if some element of {@code xs} satisfies {@code pred}
+ */
+template <typename P, typename A>
+inline bool any( P pred, list<A> const& xs )
+{
+    for ( auto e = xs._rep; e; e = e->_tail ) {
+        if ( pred( e->_head ) ) { return true; }
+    }
+    return false;
+}
+
+/**
+ * Determines whether all elements of a list satisfy a predicate; stops at the first that does not.
+ * @param pred a predicate function
+ * @param xs a list
+ * @return true if every element of {@code xs} satisfies {@code pred}
+ */
+template <typename P, typename A>
+inline bool all( P pred, list<A> const& xs )
+{
+    return !any( [&pred]( A const& x ){ return !pred( x ); }, xs );
+}
+
+/**
+ * The conjunction of a list of booleans ({@code and} in Haskell, a reserved word in C++).
+ * @param xs a list of booleans
+ * @return true if every element of {@code xs} is true
+ */
+inline bool and_( list<bool> const& xs ) { return all( []( bool x ){ return x; }, xs ); }
+
+/**
+ * The disjunction of a list of booleans ({@code or} in Haskell, a reserved word in C++).
+ * @param xs a list of booleans
+ * @return true if some element of {@code xs} is true
+ */
+inline bool or_( list<bool> const& xs ) { return any( []( bool x ){ return x; }, xs ); }
+
+// Batched folds
+
+/**
+ * Number of consecutive elements gathered per block by the batched operations.
+ * The blocking is over runs of the list, not over the set of functions: each run
+ * is visited by every function in the batch before the traversal moves on, so the
+ * elements stay in cache while the whole function set is applied to them.
+ */
+constexpr size_t BATCH_BLOCK = 512;
+
+/**
+ * Computes {@code sum(map(f,xs))} for every function {@code f} in a batch while
+ * traversing {@code xs} only once, i.e.,
+ *     {@code multi_sum({f1, ..., fk}, xs) == {sum(map(f1,xs)), ..., sum(map(fk,xs))}}
+ * No intermediate lists are built and each sum accumulates in list order, so the
+ * results are identical to the one-at-a-time version.
+ * @param fs functions that take an element of {@code xs} and return a number
+ * @param xs a finite list
+ * @return the sum of each function mapped over {@code xs}, in the order of {@code fs}
+ */
+template <typename F, typename A>
+inline auto multi_sum( std::vector<F> const& fs, list<A> const& xs )
+    -> std::vector<decltype( std::declval<F&>()( head( xs ) ) )>
+{
+    using B = decltype( std::declval<F&>()( head( xs ) ) );
+
+    std::vector<F> gs( fs );
+    std::vector<B> results( gs.size(), B( 0 ) );
+    A const* block[BATCH_BLOCK];
+    auto from = xs._rep;
+
+    while ( from ) {
+        size_t n = 0;
+        while ( from && n < BATCH_BLOCK ) {
+            block[n++] = &from->_head;
+            from = from->_tail;
+        }
+        for ( size_t k = 0; k < gs.size(); ++k ) {
+            auto& f = gs[k];
+            B result = results[k];
+            for ( size_t i = 0; i < n; ++i ) {
+                result += f( *block[i] );
+            }
+            results[k] = result;
+        }
+    }
+    return results;
+}
+
+/**
+ * Applies every predicate in a batch to a list while traversing it only once, i.e.,
+ *     {@code multi_filter({p1, ..., pk}, xs) == {filter(p1,xs), ..., filter(pk,xs)}}
+ * All k results are alive at once; where only their lengths are needed, {@code multi_sum}
+ * of indicator functions counts them without building any list.
+ * @param preds predicate functions
+ * @param xs a finite list
+ * @return for each predicate, the list of those elements of {@code xs} satisfying it
+ */
+template <typename P, typename A>
+inline std::vector<list<A>> multi_filter( std::vector<P> const& preds, list<A> const& xs )
+{
+    using node = typename list<A>::node;
+
+    std::vector<P> ps( preds );
+    std::vector<list<A>> results( ps.size(), empty<A>() );
+    std::vector<node*> ends( ps.size(), nullptr );
+    node* block[BATCH_BLOCK];
+    auto from = xs._rep;
+
+    while ( from ) {
+        size_t n = 0;
+        while ( from && n < BATCH_BLOCK ) {
+            block[n++] = from;
+            from = from->_tail;
+        }
+        for ( size_t k = 0; k < ps.size(); ++k ) {
+            auto& pred = ps[k];
+            auto to = ends[k];
+            for ( size_t i = 0; i < n; ++i ) {
+                if ( pred( block[i]->_head ) ) {
+                    if ( to ) {
+                        to = to->_tail = list<A>::acquire( new node( block[i]->_head ) );
+                    } else {
+                        to = results[k]._rep = list<A>::acquire( new node( block[i]->_head ) );
+                    }
+                }
+            }
+            ends[k] = to;
+        }
+    }
+    for ( size_t k = 0; k < ps.size(); ++k ) {
+        list<A>::seal( results[k]._rep, ends[k] );
+    }
+    return results;
+}
+
+// Zipping and unzipping lists
+
+/**
+ * Combines two lists element-wise with a function, in a single traversal and without
+ * building intermediate pairs. The result is as long as the shorter list.
+ *     {@code zipWith(f, list(x1, x2, ...), list(y1, y2, ...)) == list(f(x1, y1), f(x2, y2), ...)}
+ * @param f a binary function taking an element of {@code xs} then one of {@code ys}
+ * @param xs a list
+ * @param ys a list
+ * @return a list of the results of {@code f} applied to corresponding elements
+ */
+template <typename F, typename A, typename B>
+inline auto zipWith( F f, list<A> const& xs, list<B> const& ys ) -> list<decltype( f( head( xs ), head( ys ) ) )>
+{
+    using C = decltype( f( head( xs ), head( ys ) ) );
+    using node = typename list<C>::node;
+
+    auto from = xs._rep;
+    auto with = ys._rep;
+    if ( !from || !with ) { return empty<C>(); }
+
+    auto zs = list<C>( f( from->_head, with->_head ) );
+    auto to = zs._rep;
+    while ( (from = from->_tail) && (with = with->_tail) ) {
+        to = to->_tail = list<C>::acquire( new node( f( from->_head, with->_head ) ) );
+    }
+    list<C>::seal( zs._rep, to );
+    return zs;
+}
+
+/**
+ * Pairs up corresponding elements of two lists. The result is as long as the shorter list.
+ * @param xs a list
+ * @param ys a list
+ * @return a list of pairs of corresponding elements of {@code xs} and {@code ys}
+ */
+template <typename A, typename B>
+inline list<std::pair<A, B>> zip( list<A> const& xs, list<B> const& ys )
+{
+    return zipWith( []( A const& x, B const& y ){ return std::make_pair( x, y ); }, xs, ys );
+}
+
+/**
+ * Splits a list of pairs into a list of first components and a list of second components,
+ * building both in a single traversal.
+ * @param xys a list of pairs
+ * @return a pair of lists, such that {@code zip(unzip(xys).first, unzip(xys).second) == xys}
+ */
+template <typename A, typename B>
+inline std::pair<list<A>, list<B>> unzip( list<std::pair<A, B>> const& xys )
+{
+    using xnode = typename list<A>::node;
+    using ynode = typename list<B>::node;
+
+    auto from = xys._rep;
+    if ( !from ) { return { empty<A>(), empty<B>() }; }
+
+    auto xs = list<A>( from->_head.first );
+    auto ys = list<B>( from->_head.second );
+    auto xto = xs._rep;
+    auto yto = ys._rep;
+    while ( (from = from->_tail) ) {
+        xto = xto->_tail = list<A>::acquire( new xnode( from->_head.first ) );
+        yto = yto->_tail = list<B>::acquire( new ynode( from->_head.second ) );
+    }
+    list<A>::seal( xs._rep, xto );
+    list<B>::seal( ys._rep, yto );
+    return { std::move( xs ), std::move( ys ) };
+}
+
+// Searching lists
+
+/**
+ * Tests whether an element occurs in a list.
+ * @param x an element
+ * @param xs a finite list or list view
+ * @return true if some element of {@code xs} equals {@code x}, false otherwise
+ */
+template <typename A>
+inline bool elem( A const& x, list_ref<A> xs )
+{
+    for ( auto e = xs._rep; e; e = e->_tail ) {
+        if ( e->_head == x ) { return true; }
+    }
+    return false;
+}
+
+/**
+ * The negation of {@code elem}.
+ * @param x an element
+ * @param xs a finite list
+ * @return true if no element of {@code xs} equals {@code x}, false otherwise
+ */
+template <typename A>
+inline bool notElem( A const& x, list<A> const& xs ) { return !elem( x, xs ); }
+
+/**
+ * Looks up a key in an association list. For repeated lookups into the same
+ * association list prefer building a {@code hash_map}.
+ * @param k a key
+ * @param xs an association list of key-value pairs
+ * @return the value paired with the first occurrence of {@code k}, or nothing if there is none
+ */
+template <typename K, typename V>
+inline maybe<V> lookup( K const& k, list<std::pair<K, V>> const& xs )
+{
+    for ( auto e = xs._rep; e; e = e->_tail ) {
+        if ( e->_head.first == k ) { return just( e->_head.second ); }
+    }
+    return nothing<V>();
+}
+
+/**
+ * Finds the first element of a list satisfying a predicate.
+ * @param pred a predicate function
+ * @param xs a finite list or list view
+ * @return the first element of {@code xs} satisfying {@code pred}, or nothing if there is none
+ */
+template <typename P, typename A>
+inline maybe<A> find( P pred, list_ref<A> xs )
+{
+    for ( ; !null( xs ); xs = tail( xs ) ) {
+        if ( pred( head( xs ) ) ) { return head( xs ); }
+    }
+    return nothing();
+}
+
+/**
+ * Splits a list by a predicate in a single traversal, i.e.,
+ *     {@code partition(p, xs) == std::make_pair(filter(p, xs), filter(not p, xs))}
+ * @param pred a predicate function
+ * @param xs a list
+ * @return a pair of the elements of {@code xs} that satisfy {@code pred} and those that do not
+ */
+template <typename P, typename A>
+inline std::pair<list<A>, list<A>> partition( P pred, list<A> const& xs )
+{
+    using node = typename list<A>::node;
+
+    list<A> ys, ns;
+    node* to[2] = { nullptr, nullptr };
+    node** rep[2] = { &ns._rep, &ys._rep };
+
+    for ( auto from = xs._rep; from; from = from->_tail ) {
+        auto i = pred( from->_head ) ? 1 : 0;
+        auto n = list<A>::acquire( new node( from->_head ) );
+        to[i] = ( to[i] ? to[i]->_tail : *rep[i] ) = n;
+    }
+    list<A>::seal( ys._rep, to[1] );
+    list<A>::seal( ns._rep, to[0] );
+    return { std::move( ys ), std::move( ns ) };
+}
+
+// Lists of optional values
+
+/**
+ * Applies a partial function to each element of a list, keeping the results that exist, i.e.,
+ *     {@code mapMaybe(f, xs) == catMaybes(map(f, xs))}
+ * but in a single pass without building the intermediate list.
+ * @param f function that takes an element of {@code xs} and returns a maybe
+ * @param xs a list
+ * @return a list of the values held by the results of {@code f}, in order
+ */
+template <typename F, typename A>
+inline auto mapMaybe( F f, list<A> const& xs ) -> list<typename decltype( f( head( xs ) ) )::value_type>
+{
+    using B = typename decltype( f( head( xs ) ) )::value_type;
+    using node = typename list<B>::node;
+
+    list<B> ys;
+    node* to = nullptr;
+    for ( auto from = xs._rep; from; from = from->_tail ) {
+        auto y = f( from->_head );
+        if ( y ) {
+            auto n = list<B>::acquire( new node( std::move( *y ) ) );
+            to = ( to ? to->_tail : ys._rep ) = n;
+        }
+    }
+    list<B>::seal( ys._rep, to );
+    return ys;
+}
+
+/**
+ * Extracts the values from a list of maybes, dropping those that are nothing.
+ * @param xs a list of maybes
+ * @return a list of the values held by the elements of {@code xs}, in order
+ */
+template <typename A>
+inline list<A> catMaybes( list<maybe<A>> const& xs )
+{
+    return mapMaybe( []( maybe<A> const& x ){ return x; }, xs );
+}
+
+// Grouping and removing duplicates
+
+/**
+ * Open-addressing hash index over an external array of keys. For internal use only.
+ * Each slot holds a key's hash and its position in the array; probing is linear, so a
+ * lookup touches one flat array and compares keys only when the full hashes match.
+ */
+template <typename K, typename H>
+class _flat_index
+{
+public:
+    explicit _flat_index( H hash ) : _hash( hash ) {}
+
+    /** Position returned by {@code insert} when the key was not already present. */
+    static constexpr std::size_t NONE = std::size_t( -1 );
+
+    /**
+     * Adds key {@code k} at position {@code i} unless an equal key is already indexed.
+     * @param k a key
+     * @param i the position of {@code k} in the external array
+     * @param key_of function giving the key at an indexed position
+     * @return the position of the equal key already indexed, or {@code NONE} if {@code k} was added
+     */
+    template <typename KeyOf>
+    std::size_t insert( K const& k, std::size_t i, KeyOf key_of )
+    {
+        if ( 2 * ( _size + 1 ) > _slots.size() ) { grow(); }
+        std::uint64_t h = _hash( k );
+        for ( auto s = slot( h ); ; s = ( s + 1 ) & ( _slots.size() - 1 ) ) {
+            auto& e = _slots[s];
+            if ( e.second == NONE ) { e = { h, i }; ++_size; return NONE; }
+            if ( e.first == h && key_of( e.second ) == k ) { return e.second; }
+        }
+    }
+
+private:
+    /** Fibonacci hashing spreads weak hashes (e.g., the identity on integers) over the table. */
+    std::size_t slot( std::uint64_t h ) const { return ( h * 0x9E3779B97F4A7C15ull ) >> _shift; }
+
+    void grow()
+    {
+        std::vector<std::pair<std::uint64_t, std::size_t>> old( _slots.empty() ? 16 : 2 * _slots.size(), { 0, NONE } );
+        old.swap( _slots );
+        _shift = 64;
+        for ( auto k = _slots.size(); k > 1; k >>= 1 ) { --_shift; }
+        for ( auto& e : old ) {
+            if ( e.second == NONE ) { continue; }
+            auto s = slot( e.first );
+            while ( _slots[s].second != NONE ) { s = ( s + 1 ) & ( _slots.size() - 1 ); }
+            _slots[s] = e;
+        }
+    }
+
+    H _hash;
+    std::vector<std::pair<std::uint64_t, std::size_t>> _slots;
+    std::size_t _size = 0;
+    unsigned _shift = 64;
+};
+
+/**
+ * Removes duplicate elements from a list, keeping only the first occurrence of each.
+ * Unlike the quadratic Haskell definition, this runs in expected linear time by
+ * hashing each element once.
+ * @param xs a finite list
+ * @param hash a hash function on elements, consistent with their equality
+ * @return the list of distinct elements of {@code xs}, in order of first occurrence
+ */
+template <typename A, typename H>
+inline list<A> nub( list<A> const& xs, H hash )
+{
+    using node = typename list<A>::node;
+
+    _flat_index<A, H> seen( hash );
+    std::vector<node const*> firsts;
+    list<A> ys;
+    node* to = nullptr;
+
+    for ( auto from = xs._rep; from; from = from->_tail ) {
+        if ( seen.insert( from->_head, firsts.size(), [&]( std::size_t i ) -> A const& { return firsts[i]->_head; } )
+                != _flat_index<A, H>::NONE ) { continue; }
+        firsts.push_back( from );
+        auto n = list<A>::acquire( new node( from->_head ) );
+        to = ( to ? to->_tail : ys._rep ) = n;
+    }
+    list<A>::seal( ys._rep, to );
+    return ys;
+}
+
+/**
+ * Removes duplicate elements from a list of elements hashable by {@code std::hash}.
+ * @param xs a finite list
+ * @return the list of distinct elements of {@code xs}, in order of first occurrence
+ */
+template <typename A>
+inline list<A> nub( list<A> const& xs ) { return nub( xs, std::hash<A>() ); }
+
+/**
+ * Splits a list into runs of adjacent elements related by an equivalence predicate, i.e.,
+ * {@code concat(groupBy(eq, xs)) == xs} and every element of a run is {@code eq} to its first.
+ * @param eq an equivalence predicate
+ * @param xs a finite list
+ * @return the list of maximal runs of {@code xs}
+ */
+template <typename E, typename A>
+inline list<list<A>> groupBy( E eq, list<A> const& xs )
+{
+    using node = typename list<A>::node;
+
+    std::vector<list<A>> runs;
+    for ( auto from = xs._rep; from; ) {
+        auto first = from;
+        auto run = list<A>( from->_head );
+        auto to = run._rep;
+        while ( ( from = from->_tail ) && eq( first->_head, from->_head ) ) {
+            to = to->_tail = list<A>::acquire( new node( from->_head ) );
+        }
+        list<A>::seal( run._rep, to );
+        runs.push_back( std::move( run ) );
+    }
+
+    auto rs = empty<list<A>>();
+    for ( auto i = runs.rbegin(); i != runs.rend(); ++i ) { rs = std::move( *i ) | std::move( rs ); }
+    return rs;
+}
+
+/**
+ * Splits a list into runs of adjacent equal elements.
+ * @param xs a finite list
+ * @return the list of maximal runs of equal elements of {@code xs}
+ */
+template <typename A>
+inline list<list<A>> group( list<A> const& xs ) { return groupBy( std::equal_to<A>(), xs ); }
+
+/**
+ * Groups all the elements of a list, adjacent or not, by a key, in a single traversal
+ * using a hash index on the keys.
+ * @param f function giving the key of an element
+ * @param xs a finite list
+ * @param hash a hash function on keys, consistent with their equality
+ * @return a list of pairs of each distinct key, in order of first occurrence, and the
+ *         elements of {@code xs} having that key, in their original order
+ */
+template <typename F, typename A, typename H>
+inline auto group_on( F f, list<A> const& xs, H hash ) -> list<std::pair<decltype( f( head( xs ) ) ), list<A>>>
+{
+    using K = decltype( f( head( xs ) ) );
+    using node = typename list<A>::node;
+
+    _flat_index<K, H> index( hash );
+    std::vector<K> keys;
+    std::vector<std::pair<list<A>, node*>> groups;
+
+    for ( auto from = xs._rep; from; from = from->_tail ) {
+        K k = f( from->_head );
+        auto i = index.insert( k, keys.size(), [&]( std::size_t j ) -> K const& { return keys[j]; } );
+        if ( i == _flat_index<K, H>::NONE ) {
+            keys.push_back( std::move( k ) );
+            auto g = list<A>( from->_head );
+            auto to = g._rep;
+            groups.emplace_back( std::move( g ), to );
+        } else {
+            groups[i].second = groups[i].second->_tail = list<A>::acquire( new node( from->_head ) );
+        }
+    }
+
+    auto gs = empty<std::pair<K, list<A>>>();
+    for ( auto i = groups.size(); i-- > 0; ) {
+        list<A>::seal( groups[i].first._rep, groups[i].second );
+        gs = std::make_pair( std::move( keys[i] ), std::move( groups[i].first ) ) | std::move( gs );
+    }
+    return gs;
+}
+
+/**
+ * Groups all the elements of a list by a key hashable by {@code std::hash}.
+ * @param f function giving the key of an element
+ * @param xs a finite list
+ * @return a list of pairs of each distinct key and the elements of {@code xs} having that key
+ */
+template <typename F, typename A>
+inline auto group_on( F f, list<A> const& xs ) -> list<std::pair<decltype( f( head( xs ) ) ), list<A>>>
+{
+    return group_on( f, xs, std::hash<decltype( f( head( xs ) ) )>() );
+}
+
+/**
+ * Stably sorts a list by comparing a key computed once per element
+ * (decorate-sort-undecorate), rather than once per comparison.
+ * @param f function giving the (ordered) key of an element
+ * @param xs a finite list
+ * @return the elements of {@code xs} in ascending order of key, equal keys keeping their order
+ */
+template <typename F, typename A>
+inline list<A> sortOn( F f, list<A> const& xs )
+{
+    using node = typename list<A>::node;
+    using K = decltype( f( xs._rep->_head ) );
+
+    std::vector<std::pair<K, node const*>> decorated;
+    for ( auto from = xs._rep; from; from = from->_tail ) { decorated.emplace_back( f( from->_head ), from ); }
+    std::stable_sort( decorated.begin(), decorated.end(),
+        []( std::pair<K, node const*> const& a, std::pair<K, node const*> const& b ){ return a.first < b.first; } );
+
+    list<A> ys;
+    node* to = nullptr;
+    for ( auto& d : decorated ) {
+        auto n = list<A>::acquire( new node( d.second->_head ) );
+        to = ( to ? to->_tail : ys._rep ) = n;
+    }
+    list<A>::seal( ys._rep, to );
+    return ys;
+}
+
 // Sublists
 
 /**
@@ -521,16 +1621,21 @@ inline A sum( list<A> const& xs )
 template <typename A>
 inline list<A> take( unsigned k, list<A> const& xs )
 {
+    PRELUDE_LIST_PROBE( take, list<A>::size_of( xs._rep ) );
   	using node = typename list<A>::node;
 
   	auto from = xs._rep;
   	if ( k <= 0 || !from ) { return empty<A>(); }
+#ifdef PRELUDE_LIST_MEMO_LENGTH
+    if ( k >= from->_length ) { return xs; }
+#endif
 
 	auto ys = list<A>( from->_head );
 	auto to = ys._rep;
   	while ( --k > 0 && (from = from->_tail) ) {
 		to = to->_tail = list<A>::acquire( new node( from->_head ) );
 	}
+    list<A>::seal( ys._rep, to );
   	return ys;
 }
 
@@ -552,7 +1657,11 @@ inline list<A> take( unsigned k, list<A> const& xs )
 template <typename A>
 inline list<A> drop( unsigned k, list<A> const& xs )
 {
+    PRELUDE_LIST_PROBE( drop, list<A>::size_of( xs._rep ) );
 	if ( k <= 0 ) { return xs; }
+#ifdef PRELUDE_LIST_MEMO_LENGTH
+    if ( k >= list<A>::size_of( xs._rep ) ) { return empty<A>(); }
+#endif
 	auto to = xs._rep;
 	while ( k-- > 0 && to ) { to = to->_tail; }
   	return list<A>( to );
@@ -564,10 +1673,13 @@ inline bool operator== ( list<B> const& xs, list<B> const& ys )
     auto xs_ = xs._rep, ys_ = ys._rep;
     
     if ( xs_ == ys_ ) { return true; }
+#ifdef PRELUDE_LIST_MEMO_LENGTH
+    if ( list<B>::size_of( xs_ ) != list<B>::size_of( ys_ ) ) { return false; }
+#endif
 
 
     while ( xs_ && ys_ ) {
-        if ( xs_->_head != ys_->_head ) { return false; }
+        if ( !( xs_->_head == ys_->_head ) ) { return false; }
         xs_ = xs_->_tail;
         ys_ = ys_->_tail;
     }
@@ -1,24 +1,67 @@
 #ifndef HPP_MAYBE_LIST
 #define HPP_MAYBE_LIST
 
-#include <stdexcept>
 #include <optional>
+#include <utility>
 
 /**
  * Implementation of Haskell-like, functional programming idioms, particularly recursive lists.
  */
 namespace prelude {
 
+    /**
+     * An optional value: either {@code just(x)} or {@code nothing}. It is not const, so the
+     * result of a non-throwing prelude function can be moved out of rather than copied.
+     */
     template <typename A>
-    using maybe = std::optional<A> const;
+    using maybe = std::optional<A>;
 
+    /**
+     * Wraps a value.
+     * @param x a value
+     * @return a maybe holding {@code x}
+     */
     template <typename A>
-    maybe<A> just( A x ) { return { x }; }
+    inline maybe<A> just( A x ) { return maybe<A>( std::move( x ) ); }
 
+    /**
+     * The absent value of a given type.
+     * @return an empty maybe of element type {@code A}
+     */
     template <typename A>
-    maybe<A> nothing() { return {}; }
+    inline maybe<A> nothing() { return std::nullopt; }
+
+    /**
+     * The absent value, converting to an empty maybe of any type.
+     * @return {@code std::nullopt}
+     */
+    inline constexpr std::nullopt_t nothing() { return std::nullopt; }
+
+    /**
+     * Tests whether a maybe holds a value.
+     * @param m a maybe
+     * @return true if {@code m} holds a value, false otherwise
+     */
+    template <typename A>
+    inline bool isJust( maybe<A> const& m ) { return m.has_value(); }
+
+    /**
+     * Tests whether a maybe is empty.
+     * @param m a maybe
+     * @return true if {@code m} holds no value, false otherwise
+     */
+    template <typename A>
+    inline bool isNothing( maybe<A> const& m ) { return !m.has_value(); }
+
+    /**
+     * Extracts the value of a maybe, or a default.
+     * @param d a default value
+     * @param m a maybe
+     * @return the value held by {@code m}, or {@code d} if it is empty
+     */
+    template <typename A>
+    inline A fromMaybe( A d, maybe<A> m ) { return m ? std::move( *m ) : std::move( d ); }
 
 } // end namespace prelude
 
 #endif //HPP_MAYBE_LIST
-
@@ -0,0 +1,391 @@
+#ifndef HPP_PRELUDE_PACKED
+#define HPP_PRELUDE_PACKED
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "List.hpp"
+
+/**
+ * Implementation of Haskell-like, functional programming idioms, particularly recursive lists.
+ */
+namespace prelude {
+
+/**
+ * Immutable block of up to {@code SIZE} integers, delta encoded and bit-packed: the first
+ * value is stored whole, and each later value as its difference from its predecessor less the
+ * smallest such difference (frame of reference), in {@code _width} bits. A run of consecutive
+ * ids packs to zero bits per element. Arithmetic is modulo 2^64, so any values round-trip.
+ * For internal use only.
+ */
+template <typename A>
+struct _packed_block
+{
+    /** Number of elements in a full block. */
+    static constexpr size_t SIZE = 128;
+
+    std::uint64_t                    _first;
+    std::uint64_t                    _min_delta;
+    unsigned                         _count;
+    unsigned                         _width;
+    std::unique_ptr<std::uint64_t[]> _words;
+
+    /**
+     * Packs {@code n} values, {@code 0 < n <= SIZE}.
+     */
+    _packed_block( A const* xs, unsigned n ) : _first( static_cast<std::uint64_t>( xs[0] ) ), _min_delta( 0 ), _count( n ), _width( 0 )
+    {
+        std::uint64_t ds[SIZE];
+        for ( unsigned i = 1; i < n; ++i ) { ds[i] = static_cast<std::uint64_t>( xs[i] ) - static_cast<std::uint64_t>( xs[i - 1] ); }
+        if ( n > 1 ) {
+            // The smallest delta as a signed quantity, so near-monotone data stays narrow.
+            auto least = static_cast<std::int64_t>( ds[1] );
+            for ( unsigned i = 2; i < n; ++i ) { if ( static_cast<std::int64_t>( ds[i] ) < least ) { least = static_cast<std::int64_t>( ds[i] ); } }
+            _min_delta = static_cast<std::uint64_t>( least );
+        }
+        std::uint64_t all = 0;
+        for ( unsigned i = 1; i < n; ++i ) { ds[i] -= _min_delta; all |= ds[i]; }
+        while ( _width < 64 && ( all >> _width ) ) { ++_width; }
+        _words.reset( new std::uint64_t[words()]() );
+        for ( unsigned i = 1; i < n && _width; ++i ) {
+            auto pos = ( i - 1 ) * _width;
+            _words[pos / 64] |= ds[i] << ( pos % 64 );
+            if ( pos % 64 + _width > 64 ) { _words[pos / 64 + 1] |= ds[i] >> ( 64 - pos % 64 ); }
+        }
+    }
+
+    /** The {@code i}-th packed delta, {@code 1 <= i < _count}, less the smallest delta. */
+    std::uint64_t delta( unsigned i ) const
+    {
+        if ( !_width ) { return 0; }
+        auto pos = ( i - 1 ) * _width;
+        auto v = _words[pos / 64] >> ( pos % 64 );
+        if ( pos % 64 + _width > 64 ) { v |= _words[pos / 64 + 1] << ( 64 - pos % 64 ); }
+        return _width == 64 ? v : v & ( ( std::uint64_t( 1 ) << _width ) - 1 );
+    }
+
+    /**
+     * Decodes all elements into {@code out}. The unpacking loop has independent iterations
+     * (and none at all for width zero), so the compiler can vectorise it; only the final
+     * prefix sum is sequential.
+     */
+    void decode( A* out ) const
+    {
+        std::uint64_t ds[SIZE];
+        for ( unsigned i = 1; i < _count; ++i ) { ds[i] = delta( i ) + _min_delta; }
+        auto x = _first;
+        out[0] = static_cast<A>( x );
+        for ( unsigned i = 1; i < _count; ++i ) { x += ds[i]; out[i] = static_cast<A>( x ); }
+    }
+
+    /**
+     * Sums the elements from position {@code from} onwards without a prefix sum: the element at
+     * {@code j} is {@code x_from} plus the deltas up to {@code j}, so delta {@code i} contributes
+     * {@code count - i} times.
+     */
+    std::uint64_t sum( unsigned from ) const
+    {
+        auto x = _first;
+        for ( unsigned i = 1; i <= from; ++i ) { x += delta( i ) + _min_delta; }
+        std::uint64_t s = x * ( _count - from );
+        for ( unsigned i = from + 1; i < _count; ++i ) { s += ( delta( i ) + _min_delta ) * ( _count - i ); }
+        return s;
+    }
+
+    /** The number of 64-bit words holding the packed deltas. */
+    size_t words() const { return ( ( _count - 1 ) * _width + 63 ) / 64; }
+
+    /** The number of bits spent on this block, header included. */
+    size_t bits() const { return 8 * ( sizeof( _packed_block ) + words() * sizeof( std::uint64_t ) ); }
+};
+
+/**
+ * Immutable list of integers compressed in blocks of {@code _packed_block<A>::SIZE} elements,
+ * delta encoded and bit-packed (typically a few bits per element for ids and timestamps).
+ * Consing onto the front keeps the new elements as ordinary list nodes in front of the
+ * packed blocks, and {@code tail} is an O(1) view that advances a (block, offset) position.
+ * {@code sum}, {@code foldl}, {@code map} and {@code to_list} decode a whole block at a time.
+ *
+ * @author Matthew A Johnson
+ * @version 1.0
+ */
+template <typename A>
+class packed
+{
+    static_assert( std::is_integral<A>::value, "prelude::packed: element type must be integral" );
+public:
+    using block = std::shared_ptr<_packed_block<A> const>;
+
+private:
+    // Elements consed onto the front, uncompressed.
+    list<A>     _front;
+    // The compressed blocks; the first {@code _offset} elements of the first block are not part of this list.
+    list<block> _blocks;
+    size_t      _offset;
+    size_t      _length;
+
+    packed( list<A> front, list<block> blocks, size_t offset, size_t n )
+        : _front( std::move( front ) ), _blocks( std::move( blocks ) ), _offset( offset ), _length( n ) {}
+
+    template <typename B> friend packed<B> pack( list_ref<B> );
+    template <typename B> friend packed<B> _pack_array( B const*, size_t );
+    template <typename B> friend packed<B> operator| ( B, packed<B> const& );
+    template <typename B> friend size_t length( packed<B> const& );
+    template <typename B> friend B head( packed<B> const& );
+    template <typename B> friend packed<B> drop( size_t, packed<B> const& );
+    template <typename F, typename B, typename C> friend B foldl( F, B, packed<C> const& );
+    template <typename B> friend B sum( packed<B> const& );
+    template <typename B> friend double bits_per_element( packed<B> const& );
+};
+
+/**
+ * Compresses a list of integers.
+ * @param xs a finite list or list view
+ * @return a packed list with the elements of {@code xs}
+ */
+template <typename A>
+inline packed<A> pack( list_ref<A> xs )
+{
+    using block = typename packed<A>::block;
+    constexpr auto SIZE = _packed_block<A>::SIZE;
+    std::vector<block> bs;
+    A buf[SIZE];
+    unsigned k = 0;
+    size_t n = 0;
+    for ( ; !null( xs ); xs = tail( xs ), ++n ) {
+        buf[k++] = head( xs );
+        if ( k == SIZE ) { bs.push_back( std::make_shared<_packed_block<A> const>( buf, k ) ); k = 0; }
+    }
+    if ( k ) { bs.push_back( std::make_shared<_packed_block<A> const>( buf, k ) ); }
+    auto blocks = empty<block>();
+    for ( auto b = bs.rbegin(); b != bs.rend(); ++b ) { blocks = std::move( *b ) | std::move( blocks ); }
+    return packed<A>( empty<A>(), std::move( blocks ), 0, n );
+}
+
+/**
+ * Compresses a contiguous run of integers block by block, without an intermediate list.
+ * For internal use only.
+ * @param xs pointer to the first of {@code n} integers
+ * @param n the number of integers
+ * @return a packed list of {@code xs[0], ..., xs[n-1]}
+ */
+template <typename A>
+inline packed<A> _pack_array( A const* xs, size_t n )
+{
+    using block = typename packed<A>::block;
+    constexpr auto SIZE = _packed_block<A>::SIZE;
+    auto blocks = empty<block>();
+    for ( auto end = n; end > 0; ) {
+        auto k = end % SIZE ? end % SIZE : SIZE;
+        end -= k;
+        blocks = std::make_shared<_packed_block<A> const>( xs + end, static_cast<unsigned>( k ) ) | std::move( blocks );
+    }
+    return packed<A>( empty<A>(), std::move( blocks ), 0, n );
+}
+
+/**
+ * Constructs a packed list by pre-pending an element, which is kept uncompressed.
+ * @param x an element
+ * @param xs a packed list
+ * @return a list with {@code x} at the head and {@code xs} as the tail
+ */
+template <typename A>
+inline packed<A> operator| ( A x, packed<A> const& xs )
+{
+    return packed<A>( x | xs._front, xs._blocks, xs._offset, xs._length + 1 );
+}
+
+/**
+ * Constructs a packed list by pre-pending an element, which is kept uncompressed.
+ * @param x an element
+ * @param xs a packed list
+ * @return a list with {@code x} at the head and {@code xs} as the tail
+ */
+template <typename A>
+inline packed<A> cons( A x, packed<A> const& xs ) { return x | xs; }
+
+/**
+ * Test whether a packed list is empty.
+ * @param xs a packed list
+ * @return true if {@code xs} is empty, false otherwise
+ */
+template <typename A>
+inline bool null( packed<A> const& xs ) { return length( xs ) == 0; }
+
+/**
+ * Returns the length of a packed list in O(1).
+ * @param xs a packed list
+ * @return the number of elements in {@code xs}
+ */
+template <typename A>
+inline size_t length( packed<A> const& xs ) { return xs._length; }
+
+/**
+ * Extract the first element of a packed list, which must be non-empty.
+ * Within a block this decodes at most one block's worth of deltas.
+ * @param xs a non-empty packed list
+ * @return the first element of {@code xs}
+ * @throws std::domain_error if {@code xs} is empty
+ */
+template <typename A>
+inline A head( packed<A> const& xs )
+{
+    if ( null( xs ) ) { PRELUDE_LIST_FAIL( "prelude::head: empty list" ); }
+    if ( !null( xs._front ) ) { return head( xs._front ); }
+    auto const& b = *head( xs._blocks );
+    auto x = b._first;
+    for ( unsigned i = 1; i <= xs._offset; ++i ) { x += b.delta( i ) + b._min_delta; }
+    return static_cast<A>( x );
+}
+
+/**
+ * Extract the elements after the head of a packed list, in O(1).
+ * @param xs a non-empty packed list
+ * @return a list containing all but the first element of {@code xs}
+ * @throws std::domain_error if {@code xs} is empty
+ */
+template <typename A>
+inline packed<A> tail( packed<A> const& xs )
+{
+    if ( null( xs ) ) { PRELUDE_LIST_FAIL( "prelude::tail: empty list" ); }
+    return drop( 1, xs );
+}
+
+/**
+ * Gets what remains after removing a given number of elements, skipping whole blocks.
+ * @param k a non-negative integer
+ * @param xs a packed list
+ * @return a sublist of {@code xs} with at most {@code length-k} elements
+ */
+template <typename A>
+inline packed<A> drop( size_t k, packed<A> const& xs )
+{
+    using block = typename packed<A>::block;
+    if ( k >= xs._length ) { return packed<A>( empty<A>(), empty<block>(), 0, 0 ); }
+
+    auto n = xs._length - k;
+    list_ref<A> front = xs._front;
+    for ( ; k > 0 && !null( front ); --k ) { front = tail( front ); }
+    if ( !null( front ) ) { return packed<A>( front.own(), xs._blocks, xs._offset, n ); }
+
+    k += xs._offset;
+    list_ref<block> bs = xs._blocks;
+    while ( k >= head( bs )->_count ) { k -= head( bs )->_count; bs = tail( bs ); }
+    return packed<A>( empty<A>(), bs.own(), k, n );
+}
+
+/**
+ * Left-associative fold of a packed list, decoding one block at a time.
+ * @param f a binary operator taking the accumulator then an element
+ * @param z the starting value of the accumulator
+ * @param xs a packed list
+ * @return the final value of the accumulator
+ */
+template <typename F, typename B, typename A>
+inline B foldl( F f, B z, packed<A> const& xs )
+{
+    z = foldl( f, std::move( z ), xs._front );
+    A buf[_packed_block<A>::SIZE];
+    auto from = xs._offset;
+    for ( list_ref<typename packed<A>::block> bs = xs._blocks; !null( bs ); bs = tail( bs ), from = 0 ) {
+        auto const& b = *head( bs );
+        b.decode( buf );
+        for ( auto i = from; i < b._count; ++i ) { z = f( std::move( z ), buf[i] ); }
+    }
+    return z;
+}
+
+/**
+ * The {@code sum} function computes the sum of a packed list, block by block, from the
+ * deltas directly rather than from decoded elements.
+ * @param xs a packed list
+ * @return the sum of each element of {@code xs}
+ */
+template <typename A>
+inline A sum( packed<A> const& xs )
+{
+    auto s = static_cast<std::uint64_t>( sum( xs._front ) );
+    auto from = static_cast<unsigned>( xs._offset );
+    for ( list_ref<typename packed<A>::block> bs = xs._blocks; !null( bs ); bs = tail( bs ), from = 0 ) {
+        s += head( bs )->sum( from );
+    }
+    return static_cast<A>( s );
+}
+
+/**
+ * Expands a packed list into an ordinary list.
+ * @param xs a packed list
+ * @return a list of the elements of {@code xs}, in order
+ */
+template <typename A>
+inline list<A> to_list( packed<A> const& xs )
+{
+    std::vector<A> ys;
+    ys.reserve( length( xs ) );
+    foldl( [&ys]( int, A x ){ ys.push_back( x ); return 0; }, 0, xs );
+    auto zs = empty<A>();
+    for ( auto y = ys.rbegin(); y != ys.rend(); ++y ) { zs = *y | std::move( zs ); }
+    return zs;
+}
+
+/**
+ * Applies a function to each element of a packed list, decoding one block at a time.
+ * Integral results are packed again; other results, {@code bool} included, form an
+ * ordinary list, since {@code std::vector<bool>} has no contiguous buffer to pack from.
+ * @param f function that takes an element of {@code xs} and returns a different type
+ * @param xs a packed list
+ * @return a list of elements the same type as the return type of {@code f}
+ */
+template <typename F, typename A>
+inline auto map( F f, packed<A> const& xs )
+{
+    using B = decltype( f( std::declval<A>() ) );
+    std::vector<B> ys;
+    ys.reserve( length( xs ) );
+    foldl( [&]( int, A x ){ ys.push_back( f( x ) ); return 0; }, 0, xs );
+    if constexpr ( std::is_integral<B>::value && !std::is_same<B, bool>::value ) {
+        return _pack_array( ys.data(), ys.size() );
+    } else {
+        auto zs = empty<B>();
+        for ( auto y = ys.rbegin(); y != ys.rend(); ++y ) { zs = B( std::move( *y ) ) | std::move( zs ); }
+        return zs;
+    }
+}
+
+/**
+ * Reports the space taken by a packed list, including block headers and the uncompressed front.
+ * @param xs a packed list
+ * @return the number of bits of storage per element of {@code xs}
+ */
+template <typename A>
+inline double bits_per_element( packed<A> const& xs )
+{
+    if ( null( xs ) ) { return 0; }
+    size_t bits = 8 * length( xs._front ) * sizeof( _list_node<A> );
+    for ( list_ref<typename packed<A>::block> bs = xs._blocks; !null( bs ); bs = tail( bs ) ) {
+        bits += head( bs )->bits() + 8 * sizeof( _list_node<typename packed<A>::block> );
+    }
+    return static_cast<double>( bits ) / length( xs );
+}
+
+/**
+ * Inserts a character string serialization of a packed list into an output stream.
+ * @param os an output stream
+ * @param xs a packed list
+ * @return a reference to the output stream
+ */
+template <typename A>
+std::ostream& operator<< ( std::ostream& os, packed<A> const& xs )
+{
+    return os << to_list( xs );
+}
+
+} // end namespace prelude
+
+#endif //HPP_PRELUDE_PACKED
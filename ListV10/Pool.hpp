@@ -0,0 +1,156 @@
+#ifndef HPP_PRELUDE_POOL
+#define HPP_PRELUDE_POOL
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+#ifdef PRELUDE_LIST_ATOMIC_REFS
+#include <atomic>
+#endif
+
+/**
+ * Implementation of Haskell-like, functional programming idioms, particularly recursive lists.
+ */
+namespace prelude {
+
+/**
+ * Per-thread free list of fixed-size blocks, carved from slabs of {@code SLAB} blocks.
+ * For internal use only. A block freed on another thread joins that thread's free list.
+ * Slabs are never returned to the system, so blocks outlive the thread that carved them;
+ * they are recorded in a process-wide registry only so that they remain reachable.
+ * Shared by BasicList.hpp's {@code pool_alloc} and by the nodes of ListV1, ListV5 and ListV7.
+ */
+template <std::size_t Size, std::size_t Align>
+class _block_pool
+{
+public:
+    /** Number of blocks carved from each slab. */
+    static constexpr std::size_t SLAB = 4096;
+
+    static void* allocate()
+    {
+        auto& head = local();
+        if ( !head ) { refill( head ); }
+        auto b = head;
+        head = b->_next;
+        return b;
+    }
+    static void deallocate( void* p )
+    {
+        auto& head = local();
+        auto b = static_cast<block*>( p );
+        b->_next = head;
+        head = b;
+    }
+
+private:
+    union block
+    {
+        block* _next;
+        alignas( Align ) unsigned char _bytes[Size];
+    };
+
+    static block*& local() { thread_local block* head = nullptr; return head; }
+
+    static void refill( block*& head )
+    {
+        auto slab = static_cast<block*>( ::operator new( SLAB * sizeof( block ) ) );
+        {
+            static std::mutex lock;
+            static auto slabs = new std::vector<void*>();
+            std::lock_guard<std::mutex> guard( lock );
+            slabs->push_back( slab );
+        }
+        for ( auto i = SLAB; i-- > 0; ) {
+            slab[i]._next = head;
+            head = &slab[i];
+        }
+    }
+};
+
+/**
+ * Base of list nodes that count their own references, for {@code shared_node}.
+ * The count lives in the node itself, so there is no separate control block and no weak
+ * count; it is atomic under PRELUDE_LIST_ATOMIC_REFS, as in ListV10's list, and plain otherwise.
+ */
+class _counted
+{
+public:
+    _counted() : _refs( 0 ) {}
+    _counted( _counted const& ) : _refs( 0 ) {}
+    _counted& operator= ( _counted const& ) { return *this; }
+
+    /** Counter for tracking references to this node; atomic under PRELUDE_LIST_ATOMIC_REFS. */
+#ifdef PRELUDE_LIST_ATOMIC_REFS
+    std::atomic<std::size_t> _refs;
+#else
+    std::size_t _refs;
+#endif
+};
+
+/**
+ * Shared pointer to a list node of type {@code T}, which derives from {@code _counted}.
+ * It offers the parts of the {@code std::shared_ptr} interface that the lists use, but the
+ * count is intrusive and the node is a single block from a {@code _block_pool}.
+ */
+template <typename T>
+class shared_node
+{
+public:
+    shared_node() : _p( nullptr ) {}
+    shared_node( std::nullptr_t ) : _p( nullptr ) {}
+    shared_node( shared_node const& p ) : _p( acquire( p._p ) ) {}
+    shared_node( shared_node && p ) noexcept : _p( p._p ) { p._p = nullptr; }
+    ~shared_node() { release( _p ); }
+
+    shared_node& operator= ( shared_node const& p ) { auto q = acquire( p._p ); release( _p ); _p = q; return *this; }
+    shared_node& operator= ( shared_node && p ) noexcept
+        { if ( this != &p ) { auto q = p._p; p._p = nullptr; release( _p ); _p = q; } return *this; }
+
+    T* get() const { return _p; }
+    T& operator* () const { return *_p; }
+    T* operator-> () const { return _p; }
+    explicit operator bool() const { return _p != nullptr; }
+    /** Number of shared pointers to this node, counting this one; zero if it is null. */
+    std::size_t use_count() const { return _p ? static_cast<std::size_t>( _p->_refs ) : 0; }
+
+private:
+    explicit shared_node( T* p ) : _p( acquire( p ) ) {}
+
+    static T* acquire( T* p ) { if ( p ) { ++(p->_refs); } return p; }
+    static void release( T* p )
+    {
+        if ( p && !--(p->_refs) ) {
+            p->~T();
+            _block_pool<sizeof( T ), alignof( T )>::deallocate( p );
+        }
+    }
+
+    // The node pointed to, or nullptr.
+    T* _p;
+
+    template <typename U, typename... Args> friend shared_node<U> make_shared_node( Args&&... );
+};
+
+/**
+ * Makes a list node, with its reference count, in a single pooled allocation.
+ * @param args the arguments to the node's constructor
+ * @return a shared pointer owning the new node
+ */
+template <typename T, typename... Args>
+inline shared_node<T> make_shared_node( Args&&... args )
+{
+    auto p = _block_pool<sizeof( T ), alignof( T )>::allocate();
+    try {
+        return shared_node<T>( new ( p ) T( std::forward<Args>( args )... ) );
+    } catch ( ... ) {
+        _block_pool<sizeof( T ), alignof( T )>::deallocate( p );
+        throw;
+    }
+}
+
+} // end namespace prelude
+
+#endif //HPP_PRELUDE_POOL
@@ -0,0 +1,682 @@
+#ifndef HPP_PRELUDE_QUEUE
+#define HPP_PRELUDE_QUEUE
+
+#include <cstddef>
+#include <ostream>
+#include <stdexcept>
+#include <utility>
+
+#include "List.hpp"
+
+/**
+ * Implementation of Haskell-like, functional programming idioms, particularly recursive lists.
+ */
+namespace prelude {
+
+/**
+ * Lists that a queue or deque no longer needs, released a few nodes per operation. Dropping
+ * the last claim on a list frees all of its nodes at once, so a queue that simply dropped a
+ * front replaced by a rotation would pay O(n) in that one operation. For internal use only.
+ */
+template <typename A>
+struct _disposal
+{
+    list<list<A>> _lists = empty<list<A>>();
+
+    /** Queues a list for release. */
+    void retire( list<A> xs ) { if ( !null( xs ) ) { _lists = std::move( xs ) | std::move( _lists ); } }
+
+    /** Steps up to {@code k} nodes along the most recently queued list, releasing those it solely owned. */
+    void exec( size_t k )
+    {
+        if ( null( _lists ) ) { return; }
+        auto xs = head( _lists );
+        _lists = tail( _lists );
+        for ( ; k > 0 && !null( xs ); --k ) { xs = tail( xs ); }
+        retire( std::move( xs ) );
+    }
+};
+
+/**
+ * Progress of a queue's incremental rotation, which computes {@code f + reverse(r)} a couple
+ * of steps per queue operation: first {@code f} and {@code r} are reversed in lockstep, then the
+ * reversed front is pushed back onto the reversed rear, skipping the elements popped meanwhile
+ * ({@code _ok} counts the front elements still wanted). For internal use only.
+ */
+template <typename A>
+struct _rotation
+{
+    enum phase { idle, reversing, appending, done };
+
+    phase   _phase = idle;
+    size_t  _ok    = 0;
+    list<A> _f     = empty<A>();
+    list<A> _f2    = empty<A>();
+    list<A> _r     = empty<A>();
+    list<A> _r2    = empty<A>();
+
+    /** Starts rotating front {@code f} and rear {@code r}, with {@code length(r) == length(f) + 1}. */
+    static _rotation start( list<A> const& f, list<A> const& r )
+    {
+        _rotation s;
+        s._phase = reversing;
+        s._f = f;
+        s._r = r;
+        return s;
+    }
+
+    /** Takes one step of the rotation, in O(1). */
+    void exec()
+    {
+        if ( _phase == reversing && !null( _f ) ) {
+            ++_ok;
+            _f2 = head( _f ) | _f2;
+            _f = tail( _f );
+            _r2 = head( _r ) | _r2;
+            _r = tail( _r );
+        }
+        else if ( _phase == reversing ) {
+            _r2 = head( _r ) | _r2;
+            _r = empty<A>();
+            _phase = appending;
+        }
+        else if ( _phase == appending && _ok == 0 ) {
+            _phase = done;
+        }
+        else if ( _phase == appending ) {
+            --_ok;
+            _r2 = head( _f2 ) | _r2;
+            _f2 = tail( _f2 );
+        }
+    }
+
+    /** Notes that the front element has been popped, so one fewer is wanted from the old front. */
+    void invalidate()
+    {
+        if ( _phase == reversing ) { --_ok; }
+        else if ( _phase == appending && _ok == 0 ) { _r2 = tail( _r2 ); _phase = done; }
+        else if ( _phase == appending ) { --_ok; }
+    }
+};
+
+/**
+ * Persistent first-in first-out queue with worst-case O(1) {@code push_back}, {@code pop_front},
+ * {@code front} and {@code back}, after Hood and Melville (as presented by Okasaki). Elements
+ * are popped from a front list and pushed onto a rear list. Before the rear outgrows the front,
+ * a rotation to {@code f + reverse(r)} starts, and it advances two steps per operation, so no
+ * one operation pays for it; the lists it replaces are released a few nodes per operation too
+ * (see {@code _disposal}). Every version stays valid and shares its lists with the others.
+ *
+ * @author Matthew A Johnson
+ * @version 1.0
+ */
+template <typename A>
+class queue
+{
+public:
+    /**
+     * Constructs an empty queue.
+     */
+    queue() : _lenf( 0 ), _f( empty<A>() ), _lenr( 0 ), _r( empty<A>() ), _back( empty<A>() ) {}
+
+private:
+    // Length of the front, counting elements still in an unfinished rotation.
+    size_t       _lenf;
+    // The front; a prefix of the full front while a rotation is running.
+    list<A>      _f;
+    _rotation<A> _state;
+    size_t       _lenr;
+    // The rear, most recently pushed first.
+    list<A>      _r;
+    // A one-node list of the most recently pushed element still queued. It shares no nodes
+    // with the rear, so replacing it frees at most one node even when it was the rear's last owner.
+    list<A>      _back;
+    _disposal<A> _junk;
+
+    /**
+     * Advances the rotation two steps, installing its result if it finishes, and releases
+     * up to four nodes no longer needed: at least as many as a step allocates.
+     */
+    void exec2()
+    {
+        _state.exec();
+        _state.exec();
+        if ( _state._phase == _rotation<A>::done ) {
+            _junk.retire( std::move( _f ) );
+            _junk.retire( std::move( _state._f2 ) );
+            _f = std::move( _state._r2 );
+            _state = _rotation<A>();
+        }
+        _junk.exec( 4 );
+    }
+
+    /** Starts a rotation if the rear has outgrown the front, then advances the rotation. */
+    void check()
+    {
+        if ( _lenr > _lenf ) {
+            _state = _rotation<A>::start( _f, _r );
+            _lenf += _lenr;
+            _lenr = 0;
+            _r = empty<A>();
+        }
+        exec2();
+    }
+
+    /** Empties this queue, retiring all of its lists. */
+    void clear()
+    {
+        for ( auto xs : { &_f, &_r, &_back, &_state._f, &_state._f2, &_state._r, &_state._r2 } ) { _junk.retire( std::move( *xs ) ); }
+        auto junk = std::move( _junk );
+        *this = queue<A>();
+        _junk = std::move( junk );
+    }
+
+    template <typename B> friend queue<B> push_back( queue<B> const&, B );
+    template <typename B> friend queue<B> pop_front( queue<B> const& );
+    template <typename B> friend B const& front( queue<B> const& );
+    template <typename B> friend B const& back( queue<B> const& );
+    template <typename B> friend size_t length( queue<B> const& );
+};
+
+/**
+ * Adds an element at the back of a queue, in worst-case O(1).
+ * @param q a queue
+ * @param x an element
+ * @return a queue with the elements of {@code q} followed by {@code x}
+ */
+template <typename A>
+inline queue<A> push_back( queue<A> const& q, A x )
+{
+    auto p = q;
+    p._back = list<A>( x );
+    p._r = std::move( x ) | std::move( p._r );
+    ++p._lenr;
+    p.check();
+    return p;
+}
+
+/**
+ * Removes the element at the front of a queue, which must be non-empty, in worst-case O(1).
+ * @param q a non-empty queue
+ * @return a queue with all but the first element of {@code q}
+ * @throws std::domain_error if {@code q} is empty
+ */
+template <typename A>
+inline queue<A> pop_front( queue<A> const& q )
+{
+    if ( length( q ) == 0 ) { PRELUDE_LIST_FAIL( "prelude::pop_front: empty queue" ); }
+    auto p = q;
+    if ( length( q ) == 1 ) { p.clear(); p._junk.exec( 4 ); return p; }
+    p._f = tail( p._f );
+    --p._lenf;
+    p._state.invalidate();
+    p.check();
+    return p;
+}
+
+/**
+ * Gets the element at the front of a queue, which must be non-empty.
+ * @param q a non-empty queue
+ * @return the element that has been queued longest
+ * @throws std::domain_error if {@code q} is empty
+ */
+template <typename A>
+inline A const& front( queue<A> const& q )
+{
+    if ( length( q ) == 0 ) { PRELUDE_LIST_FAIL( "prelude::front: empty queue" ); }
+    return head( q._f );
+}
+
+/**
+ * Gets the element at the front of a temporary queue, which must be non-empty. The element is
+ * copied out, since the lists of {@code q} may be freed at the end of the full-expression.
+ * @param q a non-empty queue
+ * @return the element that has been queued longest
+ * @throws std::domain_error if {@code q} is empty
+ */
+template <typename A>
+inline A front( queue<A>&& q ) { return front( static_cast<queue<A> const&>( q ) ); }
+
+/**
+ * Gets the element at the back of a queue, which must be non-empty.
+ * @param q a non-empty queue
+ * @return the element most recently queued
+ * @throws std::domain_error if {@code q} is empty
+ */
+template <typename A>
+inline A const& back( queue<A> const& q )
+{
+    if ( length( q ) == 0 ) { PRELUDE_LIST_FAIL( "prelude::back: empty queue" ); }
+    return head( q._back );
+}
+
+/**
+ * Gets the element at the back of a temporary queue, which must be non-empty. The element is
+ * copied out, since the lists of {@code q} may be freed at the end of the full-expression.
+ * @param q a non-empty queue
+ * @return the element most recently queued
+ * @throws std::domain_error if {@code q} is empty
+ */
+template <typename A>
+inline A back( queue<A>&& q ) { return back( static_cast<queue<A> const&>( q ) ); }
+
+/**
+ * Returns the length of a queue in O(1).
+ * @param q a queue
+ * @return the number of elements in {@code q}
+ */
+template <typename A>
+inline size_t length( queue<A> const& q ) { return q._lenf + q._lenr; }
+
+/**
+ * Test whether a queue is empty.
+ * @param q a queue
+ * @return true if {@code q} is empty, false otherwise
+ */
+template <typename A>
+inline bool null( queue<A> const& q ) { return length( q ) == 0; }
+
+/**
+ * Lists the elements of a queue, front first.
+ * @param q a queue
+ * @return a list of the elements of {@code q} in the order they would be popped
+ */
+template <typename A>
+inline list<A> to_list( queue<A> q )
+{
+    auto xs = empty<A>();
+    for ( ; !null( q ); q = pop_front( q ) ) { xs = front( q ) | std::move( xs ); }
+    return reverse( xs );
+}
+
+/**
+ * Inserts a character string serialization of a queue, front first, into an output stream.
+ * @param os an output stream
+ * @param q a queue
+ * @return a reference to the output stream
+ */
+template <typename A>
+std::ostream& operator<< ( std::ostream& os, queue<A> const& q )
+{
+    return os << to_list( q );
+}
+
+/**
+ * One end of a deque: the elements nearest that end, nearest first, kept as up to three
+ * lists. {@code _x} holds the elements pushed since the last re-split started, {@code _y} the
+ * ones pushed before that while a re-split is still running, and {@code _s} the rest.
+ * Outside a re-split {@code _y} is empty. For internal use only.
+ */
+template <typename A>
+struct _deque_end
+{
+    size_t  _len = 0;
+    list<A> _x   = empty<A>();
+    list<A> _y   = empty<A>();
+    list<A> _s   = empty<A>();
+
+    /** Gets the element nearest this end, in O(1). */
+    A const& top() const { return !null( _x ) ? head( _x ) : !null( _y ) ? head( _y ) : head( _s ); }
+
+    /** Adds an element at this end, in O(1). */
+    void push( A x ) { _x = std::move( x ) | std::move( _x ); ++_len; }
+
+    /**
+     * Removes the element nearest this end, in O(1).
+     * @return true if the element was one of those in {@code _y} and {@code _s}, false if it was pushed since
+     */
+    bool pop()
+    {
+        --_len;
+        if ( !null( _x ) ) { _x = tail( _x ); return false; }
+        if ( !null( _y ) ) { _y = tail( _y ); } else { _s = tail( _s ); }
+        return true;
+    }
+};
+
+/**
+ * Progress of a deque's incremental re-split, which moves the far elements of the long end to
+ * the short one a few steps per deque operation, in the manner of the queue's rotation. With
+ * {@code L} and {@code S} the long and short ends' elements (nearest first) when it starts,
+ * and {@code i} half of all elements, it computes {@code take(i, L)} and
+ * {@code S + reverse(drop(i, L))}: first {@code L} is walked once, its first {@code i}
+ * elements reversed onto {@code _lrev} and the rest onto {@code _srot}; then {@code S} is
+ * reversed onto {@code _srev}; finally both reversals are pushed back, skipping the elements
+ * popped meanwhile ({@code _okl} and {@code _oks} count those still wanted). For internal use only.
+ */
+template <typename A>
+struct _resplit
+{
+    enum phase { idle, walking, reversing, appending_long, appending_short, done };
+
+    phase   _phase = idle;
+    // True if the front is the long end.
+    bool    _front_long = false;
+    size_t  _keep   = 0;
+    // Number of elements moving from the long end to the short one.
+    size_t  _moved  = 0;
+    size_t  _walked = 0;
+    size_t  _okl    = 0;
+    size_t  _oks    = 0;
+    // What remains to be walked of the long end and reversed of the short end.
+    list<A> _ly     = empty<A>();
+    list<A> _ls     = empty<A>();
+    list<A> _sy     = empty<A>();
+    list<A> _ss     = empty<A>();
+    list<A> _lrev   = empty<A>();
+    list<A> _lnew   = empty<A>();
+    list<A> _srev   = empty<A>();
+    list<A> _srot   = empty<A>();
+
+    /**
+     * Starts re-splitting long end {@code l} against short end {@code s}, which must both be
+     * outside a re-split. The elements of each end so far become its {@code _y} and {@code _s}.
+     */
+    static _resplit start( _deque_end<A>& l, _deque_end<A>& s, bool front_long )
+    {
+        _resplit r;
+        r._phase = walking;
+        r._front_long = front_long;
+        r._keep = ( l._len + s._len ) / 2;
+        r._moved = l._len - r._keep;
+        r._okl = r._keep;
+        r._oks = s._len;
+        for ( auto e : { &l, &s } ) { e->_y = std::move( e->_x ); e->_x = empty<A>(); }
+        r._ly = l._y;
+        r._ls = l._s;
+        r._sy = s._y;
+        r._ss = s._s;
+        return r;
+    }
+
+    /** Takes one step of the re-split, in O(1). */
+    void exec()
+    {
+        if ( _phase == walking ) {
+            auto& l = null( _ly ) ? _ls : _ly;
+            if ( _walked++ < _keep ) { _lrev = head( l ) | std::move( _lrev ); }
+            else { _srot = head( l ) | std::move( _srot ); }
+            l = tail( l );
+            if ( null( _ly ) && null( _ls ) ) { _phase = null( _sy ) && null( _ss ) ? appending_long : reversing; }
+        }
+        else if ( _phase == reversing ) {
+            auto& s = null( _sy ) ? _ss : _sy;
+            _srev = head( s ) | std::move( _srev );
+            s = tail( s );
+            if ( null( _sy ) && null( _ss ) ) { _phase = appending_long; }
+        }
+        else if ( _phase == appending_long ) {
+            if ( _okl > 0 ) {
+                --_okl;
+                _lnew = head( _lrev ) | std::move( _lnew );
+                _lrev = tail( _lrev );
+            }
+            if ( _okl == 0 ) { _phase = appending_short; }
+        }
+        else if ( _phase == appending_short ) {
+            if ( _oks > 0 ) {
+                --_oks;
+                _srot = head( _srev ) | std::move( _srot );
+                _srev = tail( _srev );
+            }
+            if ( _oks == 0 ) { _phase = done; }
+        }
+    }
+
+    /** Notes that an element of the long end from before the start has been popped. */
+    void invalidate_long()
+    {
+        if ( _phase < appending_short ) { --_okl; } else { _lnew = tail( _lnew ); }
+    }
+
+    /** Notes that an element of the short end from before the start has been popped. */
+    void invalidate_short() { --_oks; }
+};
+
+/**
+ * Persistent double-ended queue with worst-case O(1) {@code push_front}, {@code push_back},
+ * {@code pop_front}, {@code pop_back}, {@code front} and {@code back}. The elements are split
+ * between a front and a rear end (see {@code _deque_end}), and neither end may hold more
+ * than three times the other's elements, plus one. When one end outgrows that, a re-split
+ * starts that moves the far half of its elements to the other end, and it advances a fixed
+ * number of steps per operation, finishing before the short end can run out, so no one
+ * operation pays for it; the lists it replaces are released a few nodes per operation too.
+ * Every version stays valid and shares its lists with the others.
+ *
+ * @author Matthew A Johnson
+ * @version 1.0
+ */
+template <typename A>
+class deque
+{
+public:
+    /**
+     * Constructs an empty deque.
+     */
+    deque() {}
+
+private:
+    /** Neither end may be longer than this factor times the other, plus one. */
+    static constexpr size_t BALANCE = 3;
+    /**
+     * Re-split steps per operation. A re-split starting with {@code k} elements at the short
+     * end takes at most {@code 7k + 7} steps, so it finishes within {@code k} more operations.
+     */
+    static constexpr size_t STEPS = 8;
+
+    _deque_end<A> _front;
+    _deque_end<A> _rear;
+    _resplit<A>   _state;
+    _disposal<A>  _junk;
+
+    /** Adds an element at the front or the rear. */
+    void push( bool at_front, A x ) { ( at_front ? _front : _rear ).push( std::move( x ) ); check(); }
+
+    /** Removes an element from the front or the rear, noting it in any re-split. */
+    void pop( bool at_front )
+    {
+        if ( ( at_front ? _front : _rear ).pop() && _state._phase != _resplit<A>::idle ) {
+            if ( at_front == _state._front_long ) { _state.invalidate_long(); } else { _state.invalidate_short(); }
+        }
+        check();
+    }
+
+    /**
+     * Starts a re-split if either end has outgrown the other, then advances any re-split and
+     * releases up to {@code 2 * STEPS} nodes no longer needed: more than the re-split allocates.
+     */
+    void check()
+    {
+        if ( _state._phase == _resplit<A>::idle ) {
+            if ( _front._len > BALANCE * _rear._len + 1 ) { _state = _resplit<A>::start( _front, _rear, true ); }
+            else if ( _rear._len > BALANCE * _front._len + 1 ) { _state = _resplit<A>::start( _rear, _front, false ); }
+            else { return; }
+        }
+        for ( size_t k = 0; k < STEPS; ++k ) { _state.exec(); }
+        if ( _state._phase == _resplit<A>::done ) {
+            auto& l = _state._front_long ? _front : _rear;
+            auto& s = _state._front_long ? _rear : _front;
+            for ( auto xs : { &l._y, &l._s, &s._y, &s._s, &_state._lrev, &_state._srev } ) { _junk.retire( std::move( *xs ) ); }
+            l._y = s._y = empty<A>();
+            l._len -= _state._moved;
+            s._len += _state._moved;
+            l._s = std::move( _state._lnew );
+            s._s = std::move( _state._srot );
+            _state = _resplit<A>();
+        }
+        _junk.exec( 2 * STEPS );
+    }
+
+    /** Empties this deque, retiring all of its lists. */
+    void clear()
+    {
+        for ( auto e : { &_front, &_rear } ) { _junk.retire( std::move( e->_x ) ); _junk.retire( std::move( e->_y ) ); _junk.retire( std::move( e->_s ) ); }
+        for ( auto xs : { &_state._ly, &_state._ls, &_state._sy, &_state._ss, &_state._lrev, &_state._lnew, &_state._srev, &_state._srot } ) {
+            _junk.retire( std::move( *xs ) );
+        }
+        auto junk = std::move( _junk );
+        *this = deque<A>();
+        _junk = std::move( junk );
+        _junk.exec( 2 * STEPS );
+    }
+
+    template <typename B> friend deque<B> push_front( deque<B> const&, B );
+    template <typename B> friend deque<B> push_back( deque<B> const&, B );
+    template <typename B> friend deque<B> pop_front( deque<B> const& );
+    template <typename B> friend deque<B> pop_back( deque<B> const& );
+    template <typename B> friend B const& front( deque<B> const& );
+    template <typename B> friend B const& back( deque<B> const& );
+    template <typename B> friend size_t length( deque<B> const& );
+};
+
+/**
+ * Adds an element at the front of a deque, in worst-case O(1).
+ * @param d a deque
+ * @param x an element
+ * @return a deque with {@code x} followed by the elements of {@code d}
+ */
+template <typename A>
+inline deque<A> push_front( deque<A> const& d, A x )
+{
+    auto e = d;
+    e.push( true, std::move( x ) );
+    return e;
+}
+
+/**
+ * Adds an element at the back of a deque, in worst-case O(1).
+ * @param d a deque
+ * @param x an element
+ * @return a deque with the elements of {@code d} followed by {@code x}
+ */
+template <typename A>
+inline deque<A> push_back( deque<A> const& d, A x )
+{
+    auto e = d;
+    e.push( false, std::move( x ) );
+    return e;
+}
+
+/**
+ * Removes the element at the front of a deque, which must be non-empty, in worst-case O(1).
+ * @param d a non-empty deque
+ * @return a deque with all but the first element of {@code d}
+ * @throws std::domain_error if {@code d} is empty
+ */
+template <typename A>
+inline deque<A> pop_front( deque<A> const& d )
+{
+    if ( length( d ) == 0 ) { PRELUDE_LIST_FAIL( "prelude::pop_front: empty deque" ); }
+    // A lone element may sit at either end.
+    auto e = d;
+    if ( length( d ) == 1 ) { e.clear(); return e; }
+    e.pop( true );
+    return e;
+}
+
+/**
+ * Removes the element at the back of a deque, which must be non-empty, in worst-case O(1).
+ * @param d a non-empty deque
+ * @return a deque with all but the last element of {@code d}
+ * @throws std::domain_error if {@code d} is empty
+ */
+template <typename A>
+inline deque<A> pop_back( deque<A> const& d )
+{
+    if ( length( d ) == 0 ) { PRELUDE_LIST_FAIL( "prelude::pop_back: empty deque" ); }
+    auto e = d;
+    if ( length( d ) == 1 ) { e.clear(); return e; }
+    e.pop( false );
+    return e;
+}
+
+/**
+ * Gets the element at the front of a deque, which must be non-empty, in O(1).
+ * @param d a non-empty deque
+ * @return the first element of {@code d}
+ * @throws std::domain_error if {@code d} is empty
+ */
+template <typename A>
+inline A const& front( deque<A> const& d )
+{
+    if ( length( d ) == 0 ) { PRELUDE_LIST_FAIL( "prelude::front: empty deque" ); }
+    return d._front._len ? d._front.top() : d._rear.top();
+}
+
+/**
+ * Gets the element at the front of a temporary deque, which must be non-empty. The element
+ * is copied out, since the lists of {@code d} may be freed at the end of the full-expression.
+ * @param d a non-empty deque
+ * @return the first element of {@code d}
+ * @throws std::domain_error if {@code d} is empty
+ */
+template <typename A>
+inline A front( deque<A>&& d ) { return front( static_cast<deque<A> const&>( d ) ); }
+
+/**
+ * Gets the element at the back of a deque, which must be non-empty, in O(1).
+ * @param d a non-empty deque
+ * @return the last element of {@code d}
+ * @throws std::domain_error if {@code d} is empty
+ */
+template <typename A>
+inline A const& back( deque<A> const& d )
+{
+    if ( length( d ) == 0 ) { PRELUDE_LIST_FAIL( "prelude::back: empty deque" ); }
+    return d._rear._len ? d._rear.top() : d._front.top();
+}
+
+/**
+ * Gets the element at the back of a temporary deque, which must be non-empty. The element
+ * is copied out, since the lists of {@code d} may be freed at the end of the full-expression.
+ * @param d a non-empty deque
+ * @return the last element of {@code d}
+ * @throws std::domain_error if {@code d} is empty
+ */
+template <typename A>
+inline A back( deque<A>&& d ) { return back( static_cast<deque<A> const&>( d ) ); }
+
+/**
+ * Returns the length of a deque in O(1).
+ * @param d a deque
+ * @return the number of elements in {@code d}
+ */
+template <typename A>
+inline size_t length( deque<A> const& d ) { return d._front._len + d._rear._len; }
+
+/**
+ * Test whether a deque is empty.
+ * @param d a deque
+ * @return true if {@code d} is empty, false otherwise
+ */
+template <typename A>
+inline bool null( deque<A> const& d ) { return length( d ) == 0; }
+
+/**
+ * Lists the elements of a deque, front first.
+ * @param d a deque
+ * @return a list of the elements of {@code d}, in order
+ */
+template <typename A>
+inline list<A> to_list( deque<A> d )
+{
+    auto xs = empty<A>();
+    for ( ; !null( d ); d = pop_back( d ) ) { xs = back( d ) | std::move( xs ); }
+    return xs;
+}
+
+/**
+ * Inserts a character string serialization of a deque, front first, into an output stream.
+ * @param os an output stream
+ * @param d a deque
+ * @return a reference to the output stream
+ */
+template <typename A>
+std::ostream& operator<< ( std::ostream& os, deque<A> const& d )
+{
+    return os << to_list( d );
+}
+
+} // end namespace prelude
+
+#endif //HPP_PRELUDE_QUEUE
@@ -0,0 +1,422 @@
+#ifndef HPP_PRELUDE_RANGE
+#define HPP_PRELUDE_RANGE
+
+#include <cstddef>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "List.hpp"
+
+/**
+ * Implementation of Haskell-like, functional programming idioms, particularly recursive lists.
+ */
+namespace prelude {
+
+template <typename A> struct affine;
+template <typename A> struct modulo;
+
+/**
+ * Immutable arithmetic progression of integers, {@code [x, x + d, x + 2d, ...]}, held
+ * symbolically as its first element, step and length rather than as one node per element.
+ * A range takes O(1) memory; {@code length}, {@code sum}, {@code elem}, indexing,
+ * {@code head}, {@code tail}, {@code last}, {@code take}, {@code drop} and {@code reverse}
+ * are O(1) and again yield ranges. Mapping an {@code affine} function, or filtering with a
+ * {@code modulo} predicate, also stays symbolic; any other function or predicate produces an
+ * ordinary {@code list}, as does {@code to_list}.
+ *
+ * @author Matthew A Johnson
+ * @version 1.0
+ */
+template <typename A>
+class range
+{
+    static_assert( std::is_integral<A>::value, "prelude::range: element type must be integral" );
+public:
+    /**
+     * Gets the element at the specified position of this range.
+     * @param i a zero-based index
+     * @return the element at position {@code i}
+     * @throws std::domain_error if {@code i} is not less than the length of this range
+     */
+    A operator[] ( size_t i ) const
+    {
+        if ( i >= _count ) { PRELUDE_LIST_FAIL( "prelude::[]: index too large" ); }
+        return at( i );
+    }
+
+private:
+    // First element, difference between consecutive elements, and number of elements.
+    A         _start;
+    long long _step;
+    size_t    _count;
+
+    range( A start, long long step, size_t count ) : _start( start ), _step( step ), _count( count ) {}
+
+    /** Auxiliary function for the element at position {@code i}, which must be in range. */
+    A at( size_t i ) const { return static_cast<A>( _start + static_cast<long long>( i ) * _step ); }
+
+    template <typename B> friend range<B> enumFromTo( B, B );
+    template <typename B> friend range<B> enumFromThenTo( B, B, B );
+    template <typename B> friend size_t length( range<B> const& );
+    template <typename B> friend B head( range<B> const& );
+    template <typename B> friend range<B> tail( range<B> const& );
+    template <typename B> friend B last( range<B> const& );
+    template <typename B> friend range<B> take( unsigned, range<B> const& );
+    template <typename B> friend range<B> drop( unsigned, range<B> const& );
+    template <typename B> friend range<B> reverse( range<B> const& );
+    template <typename B> friend B sum( range<B> const& );
+    template <typename B> friend bool elem( B const&, range<B> const& );
+    template <typename B> friend range<B> map( affine<B> const&, range<B> const& );
+    template <typename B> friend range<B> filter( modulo<B> const&, range<B> const& );
+    template <typename F, typename B> friend auto map( F, range<B> const& ) -> list<decltype( std::declval<F&>()( std::declval<B>() ) )>;
+    template <typename P, typename B> friend list<B> filter( P, range<B> const& );
+    template <typename B> friend list<B> to_list( range<B> const& );
+    template <typename B> friend bool operator== ( range<B> const&, range<B> const& );
+};
+
+/**
+ * The affine function {@code x -> a * x + b}. Mapped over a range it yields another range;
+ * it is an ordinary function object everywhere else.
+ */
+template <typename A>
+struct affine
+{
+    A _a, _b;
+    A operator() ( A x ) const { return _a * x + _b; }
+};
+
+/**
+ * The predicate {@code x -> x mod m == r}, where the residue is taken in {@code [0, m)} even
+ * for negative {@code x}; {@code modulo<A>{ j, 0 }} is {@code x % j == 0}. Used to filter a
+ * range it yields another range; it is an ordinary predicate everywhere else.
+ */
+template <typename A>
+struct modulo
+{
+    A _m, _r;
+    bool operator() ( A x ) const { auto k = x % _m; return ( k < 0 ? k + _m : k ) == _r; }
+};
+
+/**
+ * Makes the predicate {@code x % j == 0}.
+ * @param j a positive integer
+ * @return a predicate recognised by {@code filter} on ranges
+ */
+template <typename A>
+inline modulo<A> divisible_by( A j ) { return modulo<A>{ j, 0 }; }
+
+/**
+ * Enumerates the integers from one to another inclusive, i.e.,
+ *     {@code enumFromTo(1, 5) == [1, 2, 3, 4, 5]}
+ * @param from the first element
+ * @param to the upper bound
+ * @return the range {@code [from, from + 1, ..., to]}, empty if {@code to < from}
+ */
+template <typename A>
+inline range<A> enumFromTo( A from, A to )
+{
+    return range<A>( from, 1, to < from ? 0 : static_cast<size_t>( static_cast<long long>( to ) - from ) + 1 );
+}
+
+/**
+ * Enumerates an arithmetic progression given its first two elements and a bound, i.e.,
+ *     {@code enumFromThenTo(1, 3, 10) == [1, 3, 5, 7, 9]}
+ *     {@code enumFromThenTo(5, 4, 1) == [5, 4, 3, 2, 1]}
+ * @param from the first element
+ * @param then the second element
+ * @param to the bound (an upper bound if {@code then > from}, a lower bound otherwise)
+ * @return the range of elements {@code from, then, ...} not past {@code to}
+ * @throws std::domain_error if {@code then == from} (the progression would be infinite)
+ */
+template <typename A>
+inline range<A> enumFromThenTo( A from, A then, A to )
+{
+    long long step = static_cast<long long>( then ) - from;
+    if ( step == 0 ) { PRELUDE_LIST_FAIL( "prelude::enumFromThenTo: zero step" ); }
+    long long span = static_cast<long long>( to ) - from;
+    if ( ( step > 0 && span < 0 ) || ( step < 0 && span > 0 ) ) { return range<A>( from, step, 0 ); }
+    return range<A>( from, step, static_cast<size_t>( span / step ) + 1 );
+}
+
+/**
+ * Test whether a range is empty.
+ * @param xs a range
+ * @return true if {@code xs} is empty, false otherwise
+ */
+template <typename A>
+inline bool null( range<A> const& xs ) { return length( xs ) == 0; }
+
+/**
+ * Returns the length of a range in O(1).
+ * @param xs a range
+ * @return the number of elements in {@code xs}
+ */
+template <typename A>
+inline size_t length( range<A> const& xs ) { return xs._count; }
+
+/**
+ * Extract the first element of a range, which must be non-empty.
+ * @param xs a non-empty range
+ * @return the first element of {@code xs}
+ * @throws std::domain_error if {@code xs} is empty
+ */
+template <typename A>
+inline A head( range<A> const& xs )
+{
+    if ( null( xs ) ) { PRELUDE_LIST_FAIL( "prelude::head: empty list" ); }
+    return xs._start;
+}
+
+/**
+ * Extract the elements after the head of a range, which must be non-empty.
+ * @param xs a non-empty range
+ * @return a range containing all but the first element of {@code xs}
+ * @throws std::domain_error if {@code xs} is empty
+ */
+template <typename A>
+inline range<A> tail( range<A> const& xs )
+{
+    if ( null( xs ) ) { PRELUDE_LIST_FAIL( "prelude::tail: empty list" ); }
+    return drop( 1, xs );
+}
+
+/**
+ * Extract the last element of a range, which must be non-empty.
+ * @param xs a non-empty range
+ * @return the last element of {@code xs}
+ * @throws std::domain_error if {@code xs} is empty
+ */
+template <typename A>
+inline A last( range<A> const& xs )
+{
+    if ( null( xs ) ) { PRELUDE_LIST_FAIL( "prelude::last: empty list" ); }
+    return xs.at( xs._count - 1 );
+}
+
+/**
+ * Gets from a range its leading subrange of a given size if one exists.
+ * @param k a non-negative integer
+ * @param xs a range
+ * @return a subrange of {@code xs} with at most {@code k} elements
+ */
+template <typename A>
+inline range<A> take( unsigned k, range<A> const& xs )
+{
+    return range<A>( xs._start, xs._step, k < xs._count ? k : xs._count );
+}
+
+/**
+ * Gets what remains after removing a given number of elements from a range.
+ * @param k a non-negative integer
+ * @param xs a range
+ * @return a subrange of {@code xs} with at most {@code length-k} elements
+ */
+template <typename A>
+inline range<A> drop( unsigned k, range<A> const& xs )
+{
+    if ( k >= xs._count ) { return range<A>( xs._start, xs._step, 0 ); }
+    return range<A>( xs.at( k ), xs._step, xs._count - k );
+}
+
+/**
+ * Reverses a range.
+ * @param xs a range
+ * @return a range whose elements are the same as {@code xs} but in reverse order
+ */
+template <typename A>
+inline range<A> reverse( range<A> const& xs )
+{
+    if ( null( xs ) ) { return xs; }
+    return range<A>( last( xs ), -xs._step, xs._count );
+}
+
+/**
+ * The {@code sum} function computes the sum of a range in closed form.
+ * @param xs a range
+ * @return the sum of each element of {@code xs}
+ */
+template <typename A>
+inline A sum( range<A> const& xs )
+{
+    auto n = static_cast<long long>( xs._count );
+    auto pairs = n % 2 == 0 ? ( n / 2 ) * ( n - 1 ) : n * ( ( n - 1 ) / 2 );
+    return static_cast<A>( n * xs._start + pairs * xs._step );
+}
+
+/**
+ * Tests whether an element occurs in a range, in O(1).
+ * @param x an element
+ * @param xs a range
+ * @return true if some element of {@code xs} equals {@code x}, false otherwise
+ */
+template <typename A>
+inline bool elem( A const& x, range<A> const& xs )
+{
+    if ( null( xs ) ) { return false; }
+    auto d = static_cast<long long>( x ) - xs._start;
+    // A constant range, such as one mapped through {@code affine{0, b}}, has a single value.
+    if ( xs._step == 0 ) { return d == 0; }
+    if ( d % xs._step != 0 ) { return false; }
+    auto i = d / xs._step;
+    return i >= 0 && static_cast<size_t>( i ) < xs._count;
+}
+
+/**
+ * Maps an affine function over a range, in O(1).
+ * @param f the function {@code x -> a * x + b}
+ * @param xs a range
+ * @return the range {@code [f(x1), f(x2), ...]}
+ */
+template <typename A>
+inline range<A> map( affine<A> const& f, range<A> const& xs )
+{
+    return range<A>( f( xs._start ), xs._step * f._a, xs._count );
+}
+
+/**
+ * Auxiliary function for {@code a * b mod m} without overflow, for {@code a, b < m}.
+ */
+inline unsigned long long _mulmod( unsigned long long a, unsigned long long b, unsigned long long m )
+{
+    unsigned long long r = 0;
+    for ( a %= m; b; b >>= 1 ) {
+        if ( b & 1 ) { r = r >= m - a ? r - ( m - a ) : r + a; }
+        a = a >= m - a ? a - ( m - a ) : a + a;
+    }
+    return r;
+}
+
+/**
+ * Auxiliary function for the inverse of {@code a} modulo {@code m}, for coprime {@code a} and {@code m}.
+ */
+inline unsigned long long _invmod( unsigned long long a, unsigned long long m )
+{
+    long long r0 = static_cast<long long>( m ), r1 = static_cast<long long>( a % m );
+    long long s0 = 0, s1 = 1;
+    while ( r1 ) {
+        auto q = r0 / r1;
+        auto r = r0 - q * r1; r0 = r1; r1 = r;
+        auto s = s0 - q * s1; s0 = s1; s1 = s;
+    }
+    return static_cast<unsigned long long>( s0 < 0 ? s0 + static_cast<long long>( m ) : s0 ) % m;
+}
+
+/**
+ * Filters a range by a congruence, in O(log m). The elements {@code x0 + i * d} with
+ * {@code x mod m == r} are those whose index {@code i} solves {@code i * d == r - x0 (mod m)},
+ * which form an arithmetic progression of indices, so the result is itself a range.
+ * @param p the predicate {@code x -> x mod m == r}, with {@code m > 0}
+ * @param xs a range
+ * @return the range of elements of {@code xs} satisfying {@code p}
+ */
+template <typename A>
+inline range<A> filter( modulo<A> const& p, range<A> const& xs )
+{
+    auto none = range<A>( xs._start, xs._step, 0 );
+    if ( p._m <= 0 ) { PRELUDE_LIST_FAIL( "prelude::filter: non-positive modulus" ); }
+    if ( null( xs ) ) { return none; }
+
+    auto m = static_cast<unsigned long long>( p._m );
+    auto residue = []( long long x, unsigned long long m ){
+        auto k = x % static_cast<long long>( m );
+        return static_cast<unsigned long long>( k < 0 ? k + static_cast<long long>( m ) : k );
+    };
+    auto d = residue( xs._step, m );
+    auto target = residue( static_cast<long long>( p._r ) - xs._start, m );
+
+    auto g = m;
+    for ( auto a = d; a; ) { auto t = g % a; g = a; a = t; }
+    if ( target % g != 0 ) { return none; }
+
+    auto period = m / g;
+    auto first = period == 1 ? 0 : _mulmod( target / g, _invmod( d / g, period ), period );
+    if ( first >= xs._count ) { return none; }
+    return range<A>( xs.at( first ), xs._step * static_cast<long long>( period ),
+                     ( xs._count - 1 - first ) / period + 1 );
+}
+
+/**
+ * Converts a range to a list by applying a function to each element.
+ * @param f function that takes an element of {@code xs} and returns a different type
+ * @param xs a range
+ * @return a list of elements the same type as the return type of {@code f}
+ */
+template <typename F, typename A>
+inline auto map( F f, range<A> const& xs ) -> list<decltype( std::declval<F&>()( std::declval<A>() ) )>
+{
+    using B = decltype( f( std::declval<A>() ) );
+    std::vector<B> ys;
+    ys.reserve( xs._count );
+    for ( size_t i = 0; i < xs._count; ++i ) { ys.push_back( f( xs.at( i ) ) ); }
+    auto zs = empty<B>();
+    for ( auto y = ys.rbegin(); y != ys.rend(); ++y ) { zs = std::move( *y ) | std::move( zs ); }
+    return zs;
+}
+
+/**
+ * Extracts the elements of a range satisfying a predicate that is not a {@code modulo}.
+ * @param pred a predicate function
+ * @param xs a range
+ * @return a list containing those elements of {@code xs} satisfying {@code pred}
+ */
+template <typename P, typename A>
+inline list<A> filter( P pred, range<A> const& xs )
+{
+    auto ys = empty<A>();
+    for ( auto i = xs._count; i-- > 0; ) {
+        auto x = xs.at( i );
+        if ( pred( x ) ) { ys = x | std::move( ys ); }
+    }
+    return ys;
+}
+
+/**
+ * Materialises a range as a list.
+ * @param xs a range
+ * @return a list of the elements of {@code xs}, in order
+ */
+template <typename A>
+inline list<A> to_list( range<A> const& xs )
+{
+    auto ys = empty<A>();
+    for ( auto i = xs._count; i-- > 0; ) { ys = xs.at( i ) | std::move( ys ); }
+    return ys;
+}
+
+/**
+ * Compares two ranges element by element, in O(1).
+ * @param xs a range
+ * @param ys a range
+ * @return true if {@code xs} and {@code ys} have equal elements in the same order
+ */
+template <typename A>
+inline bool operator== ( range<A> const& xs, range<A> const& ys )
+{
+    if ( xs._count != ys._count ) { return false; }
+    if ( xs._count == 0 ) { return true; }
+    return xs._start == ys._start && ( xs._count == 1 || xs._step == ys._step );
+}
+
+/**
+ * Inserts a character string serialization of a range into an output stream.
+ * @param os an output stream
+ * @param xs a range
+ * @return a reference to the output stream
+ */
+template <typename A>
+std::ostream& operator<< ( std::ostream& os, range<A> const& xs )
+{
+    os << '[';
+    for ( size_t i = 0; i < length( xs ); ++i ) {
+        if ( i ) { os << ','; }
+        os << xs[i];
+    }
+    return os << ']';
+}
+
+} // end namespace prelude
+
+#endif //HPP_PRELUDE_RANGE
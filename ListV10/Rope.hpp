@@ -0,0 +1,565 @@
+#ifndef HPP_PRELUDE_ROPE
+#define HPP_PRELUDE_ROPE
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "List.hpp"
+
+/**
+ * Implementation of Haskell-like, functional programming idioms, particularly recursive lists.
+ */
+namespace prelude {
+
+struct _rope_node;
+using _rope_ptr = std::shared_ptr<_rope_node const>;
+
+/**
+ * Immutable node of a rope: either a leaf viewing {@code _length} bytes of a shared buffer
+ * from {@code _start}, or a concatenation of two non-empty ropes. Heights keep the tree
+ * AVL-balanced; a leaf has height 1. For internal use only.
+ */
+struct _rope_node
+{
+    /** Most bytes in a leaf cut from a larger string. */
+    static constexpr size_t LEAF = 4096;
+    /** Leaves this small are copied together when concatenated, rather than linked. */
+    static constexpr size_t SMALL = 128;
+
+    std::shared_ptr<std::string const> _buf;
+    size_t                             _start;
+    size_t                             _length;
+    unsigned                           _height;
+    _rope_ptr                          _left;
+    _rope_ptr                          _right;
+
+    bool leaf() const { return _height == 1; }
+
+    /** The bytes of a leaf. */
+    std::string_view view() const { return std::string_view( _buf->data() + _start, _length ); }
+};
+
+inline unsigned _rope_height( _rope_ptr const& t ) { return t ? t->_height : 0; }
+
+inline size_t _rope_length( _rope_ptr const& t ) { return t ? t->_length : 0; }
+
+inline _rope_ptr _rope_leaf( std::shared_ptr<std::string const> buf, size_t start, size_t n )
+{
+    if ( !n ) { return nullptr; }
+    return std::make_shared<_rope_node const>( _rope_node{ std::move( buf ), start, n, 1, nullptr, nullptr } );
+}
+
+inline _rope_ptr _rope_link( _rope_ptr l, _rope_ptr r )
+{
+    auto n = l->_length + r->_length;
+    auto h = 1 + std::max( l->_height, r->_height );
+    return std::make_shared<_rope_node const>( _rope_node{ nullptr, 0, n, h, std::move( l ), std::move( r ) } );
+}
+
+/** Links two trees whose heights differ by at most two, rotating to restore balance. */
+inline _rope_ptr _rope_balance( _rope_ptr const& l, _rope_ptr const& r )
+{
+    if ( _rope_height( l ) > _rope_height( r ) + 1 ) {
+        if ( _rope_height( l->_left ) >= _rope_height( l->_right ) ) { return _rope_link( l->_left, _rope_link( l->_right, r ) ); }
+        return _rope_link( _rope_link( l->_left, l->_right->_left ), _rope_link( l->_right->_right, r ) );
+    }
+    if ( _rope_height( r ) > _rope_height( l ) + 1 ) {
+        if ( _rope_height( r->_right ) >= _rope_height( r->_left ) ) { return _rope_link( _rope_link( l, r->_left ), r->_right ); }
+        return _rope_link( _rope_link( l, r->_left->_left ), _rope_link( r->_left->_right, r->_right ) );
+    }
+    return _rope_link( l, r );
+}
+
+/** Concatenates two trees in O(|height difference|), descending the taller one's spine. */
+inline _rope_ptr _rope_join( _rope_ptr const& l, _rope_ptr const& r )
+{
+    if ( !l ) { return r; }
+    if ( !r ) { return l; }
+    if ( l->leaf() && r->leaf() && l->_length + r->_length <= _rope_node::SMALL ) {
+        auto s = std::string( l->view() );
+        s += r->view();
+        auto n = s.size();
+        return _rope_leaf( std::make_shared<std::string const>( std::move( s ) ), 0, n );
+    }
+    if ( l->_height > r->_height + 1 ) { return _rope_balance( l->_left, _rope_join( l->_right, r ) ); }
+    if ( r->_height > l->_height + 1 ) { return _rope_balance( _rope_join( l, r->_left ), r->_right ); }
+    return _rope_link( l, r );
+}
+
+/** Splits a tree before position {@code k}, sharing leaf buffers, in O(log n). */
+inline std::pair<_rope_ptr, _rope_ptr> _rope_split( _rope_ptr const& t, size_t k )
+{
+    if ( !t || k == 0 ) { return { nullptr, t }; }
+    if ( k >= t->_length ) { return { t, nullptr }; }
+    if ( t->leaf() ) { return { _rope_leaf( t->_buf, t->_start, k ), _rope_leaf( t->_buf, t->_start + k, t->_length - k ) }; }
+    if ( k < t->_left->_length ) {
+        auto lr = _rope_split( t->_left, k );
+        return { std::move( lr.first ), _rope_join( lr.second, t->_right ) };
+    }
+    auto rr = _rope_split( t->_right, k - t->_left->_length );
+    return { _rope_join( t->_left, rr.first ), std::move( rr.second ) };
+}
+
+/** Builds a balanced tree over bytes {@code [start, start+n)} of a buffer, without copying. */
+inline _rope_ptr _rope_build( std::shared_ptr<std::string const> const& buf, size_t start, size_t n )
+{
+    if ( n <= _rope_node::LEAF ) { return _rope_leaf( buf, start, n ); }
+    auto half = n / 2;
+    return _rope_link( _rope_build( buf, start, half ), _rope_build( buf, start + half, n - half ) );
+}
+
+/** Visits the leaves of a tree in order; stops early if {@code f} returns false. */
+template <typename F>
+inline bool _rope_visit( _rope_node const* t, F& f )
+{
+    for ( ; t && !t->leaf(); t = t->_right.get() ) {
+        if ( !_rope_visit( t->_left.get(), f ) ) { return false; }
+    }
+    return !t || f( *t );
+}
+
+/**
+ * Immutable string as a balanced tree (a rope) of immutable byte chunks, shared between
+ * ropes: concatenation, {@code take}, {@code drop}, {@code splitAt} and indexing are O(log n),
+ * and slicing never copies bytes. Whole-rope operations ({@code elem}, {@code isPrefixOf},
+ * {@code lines}, {@code words}, {@code to_string}) run over each chunk with the C library's
+ * block primitives ({@code memchr}, {@code memcmp}, {@code memcpy}). It offers the list
+ * functions on {@code char} that make sense for strings, at about one byte per character
+ * rather than a list node.
+ *
+ * @author Matthew A Johnson
+ * @version 1.0
+ */
+class rope
+{
+public:
+    /**
+     * Constructs an empty rope.
+     */
+    rope() = default;
+
+    /**
+     * Constructs a rope of a copy of a string's bytes.
+     * @param s a string
+     */
+    explicit rope( std::string_view s ) : rope( std::string( s ) ) {}
+
+    /**
+     * Constructs a rope taking over a string's bytes, without copying them.
+     * @param s a string
+     */
+    explicit rope( std::string&& s )
+    {
+        auto n = s.size();
+        _root = _rope_build( std::make_shared<std::string const>( std::move( s ) ), 0, n );
+    }
+
+    /**
+     * Constructs a rope of a copy of a C string.
+     * @param s a null-terminated string
+     */
+    explicit rope( char const* s ) : rope( std::string_view( s ) ) {}
+
+    /**
+     * Gets the byte at a position, in O(log n).
+     * @param i a zero-based index
+     * @return the character at position {@code i}
+     * @throws std::domain_error if {@code i} is not less than the length of this rope
+     */
+    char operator[] ( size_t i ) const PRELUDE_LIST_NOTHROW
+    {
+        if ( i >= _rope_length( _root ) ) { PRELUDE_LIST_FAIL( "prelude::[]: index too large" ); }
+        auto t = _root.get();
+        while ( !t->leaf() ) {
+            if ( i < t->_left->_length ) { t = t->_left.get(); } else { i -= t->_left->_length; t = t->_right.get(); }
+        }
+        return t->view()[i];
+    }
+
+private:
+    // Root of the tree, or nullptr for the empty rope.
+    _rope_ptr _root;
+
+    explicit rope( _rope_ptr t ) : _root( std::move( t ) ) {}
+
+    friend rope operator| ( char, rope const& );
+    friend rope operator+ ( rope const&, rope const& );
+    friend size_t length( rope const& );
+    friend std::pair<rope, rope> splitAt( size_t, rope const& );
+    friend maybe<std::string_view> flat( rope const& );
+    template <typename F> friend bool _rope_chunks( F, rope const& );
+    template <typename F> friend list<rope> _rope_fields( F, bool, rope const& );
+};
+
+/**
+ * Constructs a rope by pre-pending a character, in O(log n).
+ * @param x a character
+ * @param xs a rope
+ * @return a rope with {@code x} at the head and {@code xs} as the tail
+ */
+inline rope operator| ( char x, rope const& xs )
+{
+    return rope( _rope_join( _rope_leaf( std::make_shared<std::string const>( 1, x ), 0, 1 ), xs._root ) );
+}
+
+/**
+ * Constructs a rope by pre-pending a character, in O(log n).
+ * @param x a character
+ * @param xs a rope
+ * @return a rope with {@code x} at the head and {@code xs} as the tail
+ */
+inline rope cons( char x, rope const& xs ) { return x | xs; }
+
+/**
+ * Concatenates two ropes in O(log n), sharing the chunks of both.
+ * @param xs a rope
+ * @param ys a rope
+ * @return a rope with the characters of {@code xs} followed by those of {@code ys}
+ */
+inline rope operator+ ( rope const& xs, rope const& ys ) { return rope( _rope_join( xs._root, ys._root ) ); }
+
+/**
+ * Returns the length of a rope in O(1).
+ * @param xs a rope
+ * @return the number of characters in {@code xs}
+ */
+inline size_t length( rope const& xs ) { return _rope_length( xs._root ); }
+
+/**
+ * Test whether a rope is empty.
+ * @param xs a rope
+ * @return true if {@code xs} is empty, false otherwise
+ */
+inline bool null( rope const& xs ) { return length( xs ) == 0; }
+
+/**
+ * Splits a rope at a position, in O(log n) and without copying characters.
+ * @param k a non-negative integer
+ * @param xs a rope
+ * @return the first {@code k} characters of {@code xs} (or all of it) and the rest
+ */
+inline std::pair<rope, rope> splitAt( size_t k, rope const& xs )
+{
+    auto lr = _rope_split( xs._root, k );
+    return { rope( std::move( lr.first ) ), rope( std::move( lr.second ) ) };
+}
+
+/**
+ * Gets the first few characters of a rope, in O(log n).
+ * @param k a non-negative integer
+ * @param xs a rope
+ * @return a rope of the first {@code k} characters of {@code xs}, or all of it if shorter
+ */
+inline rope take( size_t k, rope const& xs ) { return splitAt( k, xs ).first; }
+
+/**
+ * Gets what remains after removing the first few characters of a rope, in O(log n).
+ * @param k a non-negative integer
+ * @param xs a rope
+ * @return a rope with at most {@code length-k} characters
+ */
+inline rope drop( size_t k, rope const& xs ) { return splitAt( k, xs ).second; }
+
+/**
+ * Extract the first character of a rope, which must be non-empty.
+ * @param xs a non-empty rope
+ * @return the first character of {@code xs}
+ * @throws std::domain_error if {@code xs} is empty
+ */
+inline char head( rope const& xs )
+{
+    if ( null( xs ) ) { PRELUDE_LIST_FAIL( "prelude::head: empty list" ); }
+    return xs[0];
+}
+
+/**
+ * Extract the last character of a rope, which must be non-empty.
+ * @param xs a non-empty rope
+ * @return the last character of {@code xs}
+ * @throws std::domain_error if {@code xs} is empty
+ */
+inline char last( rope const& xs )
+{
+    if ( null( xs ) ) { PRELUDE_LIST_FAIL( "prelude::last: empty list" ); }
+    return xs[length( xs ) - 1];
+}
+
+/**
+ * Extract the characters after the head of a rope, in O(log n).
+ * @param xs a non-empty rope
+ * @return a rope containing all but the first character of {@code xs}
+ * @throws std::domain_error if {@code xs} is empty
+ */
+inline rope tail( rope const& xs )
+{
+    if ( null( xs ) ) { PRELUDE_LIST_FAIL( "prelude::tail: empty list" ); }
+    return drop( 1, xs );
+}
+
+/**
+ * Return all the characters of a rope except the last one, in O(log n).
+ * @param xs a non-empty rope
+ * @return a rope containing all but the last character of {@code xs}
+ * @throws std::domain_error if {@code xs} is empty
+ */
+inline rope init( rope const& xs )
+{
+    if ( null( xs ) ) { PRELUDE_LIST_FAIL( "prelude::init: empty list" ); }
+    return take( length( xs ) - 1, xs );
+}
+
+/**
+ * Visits the chunks of a rope in order. For internal use only.
+ * @param f a function taking a non-empty string view and returning false to stop early
+ * @param xs a rope
+ * @return false if {@code f} stopped the traversal, true otherwise
+ */
+template <typename F>
+inline bool _rope_chunks( F f, rope const& xs )
+{
+    auto g = [&f]( _rope_node const& n ){ return f( n.view() ); };
+    return _rope_visit( xs._root.get(), g );
+}
+
+/**
+ * Views the characters of a rope in place, if they are contiguous: always so for a rope
+ * made from one string of up to {@code _rope_node::LEAF} bytes, or a slice of one chunk.
+ * @param xs a rope
+ * @return a view of the characters of {@code xs}, or nothing if it spans several chunks
+ */
+inline maybe<std::string_view> flat( rope const& xs )
+{
+    if ( !xs._root ) { return just( std::string_view() ); }
+    return xs._root->leaf() ? just( xs._root->view() ) : nothing<std::string_view>();
+}
+
+/**
+ * Views each chunk of a rope in place, without copying.
+ * @param xs a rope
+ * @return the chunks of {@code xs} in order; their concatenation is {@code xs}
+ */
+inline list<std::string_view> chunks( rope const& xs )
+{
+    std::vector<std::string_view> vs;
+    _rope_chunks( [&vs]( std::string_view v ){ vs.push_back( v ); return true; }, xs );
+    auto ys = empty<std::string_view>();
+    for ( auto v = vs.rbegin(); v != vs.rend(); ++v ) { ys = *v | std::move( ys ); }
+    return ys;
+}
+
+/**
+ * Copies the characters of a rope into a string, a chunk at a time.
+ * @param xs a rope
+ * @return a string with the characters of {@code xs}
+ */
+inline std::string to_string( rope const& xs )
+{
+    std::string s;
+    s.reserve( length( xs ) );
+    _rope_chunks( [&s]( std::string_view v ){ s.append( v.data(), v.size() ); return true; }, xs );
+    return s;
+}
+
+/**
+ * Converts a list of characters into a rope.
+ * @param xs a finite list of characters or list view
+ * @return a rope with the characters of {@code xs}
+ */
+inline rope to_rope( list_ref<char> xs )
+{
+    std::string s;
+    for ( ; !null( xs ); xs = tail( xs ) ) { s += head( xs ); }
+    return rope( std::move( s ) );
+}
+
+/**
+ * Converts a rope into a list of characters.
+ * @param xs a rope
+ * @return a list of the characters of {@code xs}
+ */
+inline list<char> to_list( rope const& xs )
+{
+    auto s = to_string( xs );
+    auto ys = empty<char>();
+    for ( auto c = s.rbegin(); c != s.rend(); ++c ) { ys = *c | std::move( ys ); }
+    return ys;
+}
+
+/**
+ * Left-associative fold of a rope, a chunk at a time.
+ * @param f a binary operator taking the accumulator then a character
+ * @param z the starting value of the accumulator
+ * @param xs a rope
+ * @return the final value of the accumulator
+ */
+template <typename F, typename B>
+inline B foldl( F f, B z, rope const& xs )
+{
+    _rope_chunks( [&]( std::string_view v ){ for ( auto c : v ) { z = f( std::move( z ), c ); } return true; }, xs );
+    return z;
+}
+
+/**
+ * Applies a function to each character of a rope.
+ * @param f function from a character to a character
+ * @param xs a rope
+ * @return a rope of the results, in order
+ */
+template <typename F>
+inline rope map( F f, rope const& xs )
+{
+    std::string s( length( xs ), '\0' );
+    auto to = s.begin();
+    _rope_chunks( [&]( std::string_view v ){ to = std::transform( v.begin(), v.end(), to, f ); return true; }, xs );
+    return rope( std::move( s ) );
+}
+
+/**
+ * Keeps the characters of a rope that satisfy a predicate.
+ * @param pred a predicate function
+ * @param xs a rope
+ * @return a rope of the characters of {@code xs} that satisfy {@code pred}, in order
+ */
+template <typename P>
+inline rope filter( P pred, rope const& xs )
+{
+    std::string s;
+    _rope_chunks( [&]( std::string_view v ){ std::copy_if( v.begin(), v.end(), std::back_inserter( s ), pred ); return true; }, xs );
+    return rope( std::move( s ) );
+}
+
+/**
+ * Searches a rope for a character, with {@code memchr} on each chunk.
+ * @param x a character
+ * @param xs a rope
+ * @return true if {@code x} occurs in {@code xs}, false otherwise
+ */
+inline bool elem( char x, rope const& xs )
+{
+    return !_rope_chunks( [x]( std::string_view v ){ return !std::memchr( v.data(), x, v.size() ); }, xs );
+}
+
+/**
+ * Tests whether a rope begins with another, comparing chunk against chunk with {@code memcmp}.
+ * @param xs a candidate prefix
+ * @param ys a rope
+ * @return true if {@code ys} begins with the characters of {@code xs}
+ */
+inline bool isPrefixOf( rope const& xs, rope const& ys )
+{
+    if ( length( xs ) > length( ys ) ) { return false; }
+    auto rest = take( length( xs ), ys );
+    std::vector<std::string_view> vs;
+    _rope_chunks( [&vs]( std::string_view v ){ vs.push_back( v ); return true; }, rest );
+    auto v = vs.begin();
+    size_t at = 0;
+    return _rope_chunks( [&]( std::string_view u ){
+        while ( !u.empty() ) {
+            auto k = std::min( u.size(), v->size() - at );
+            if ( std::memcmp( u.data(), v->data() + at, k ) ) { return false; }
+            u.remove_prefix( k );
+            if ( ( at += k ) == v->size() ) { ++v; at = 0; }
+        }
+        return true;
+    }, xs );
+}
+
+/**
+ * Compares two ropes for equality, chunk by chunk.
+ * @param xs a rope
+ * @param ys a rope
+ * @return true if {@code xs} and {@code ys} have the same characters in the same order
+ */
+inline bool operator== ( rope const& xs, rope const& ys )
+{
+    return length( xs ) == length( ys ) && isPrefixOf( xs, ys );
+}
+
+/**
+ * Cuts a rope into the fields between separator characters. A field within one chunk is a
+ * slice of that chunk, and one spanning chunks is joined from slices, so no bytes are copied.
+ * For internal use only.
+ * @param find a function giving the index of the next separator in a chunk at or after a
+ *        position, or {@code npos}
+ * @param keep_empty whether empty fields are kept; a trailing empty field never is
+ * @param xs a rope
+ * @return the fields of {@code xs}, in order
+ */
+template <typename F>
+inline list<rope> _rope_fields( F find, bool keep_empty, rope const& xs )
+{
+    std::vector<rope> fs;
+    _rope_ptr pending;
+    auto cut = [&]( _rope_node const& n ){
+        auto v = n.view();
+        size_t from = 0;
+        for ( size_t p; ( p = find( v, from ) ) != std::string_view::npos; from = p + 1 ) {
+            auto field = _rope_join( pending, _rope_leaf( n._buf, n._start + from, p - from ) );
+            if ( field || keep_empty ) { fs.push_back( rope( std::move( field ) ) ); }
+            pending = nullptr;
+        }
+        pending = _rope_join( pending, _rope_leaf( n._buf, n._start + from, v.size() - from ) );
+        return true;
+    };
+    _rope_visit( xs._root.get(), cut );
+    if ( pending ) { fs.push_back( rope( std::move( pending ) ) ); }
+    auto ys = empty<rope>();
+    for ( auto f = fs.rbegin(); f != fs.rend(); ++f ) { ys = std::move( *f ) | std::move( ys ); }
+    return ys;
+}
+
+/**
+ * Splits a rope at newline characters, which are removed; a final newline does not start
+ * another line. Lines are found with {@code memchr} and cut out without copying.
+ * @param xs a rope
+ * @return the lines of {@code xs}, in order
+ */
+inline list<rope> lines( rope const& xs )
+{
+    return _rope_fields( []( std::string_view v, size_t from ){
+        auto p = static_cast<char const*>( std::memchr( v.data() + from, '\n', v.size() - from ) );
+        return p ? static_cast<size_t>( p - v.data() ) : std::string_view::npos;
+    }, true, xs );
+}
+
+/**
+ * Splits a rope into words separated by white space, which is removed. Words are cut out
+ * without copying.
+ * @param xs a rope
+ * @return the words of {@code xs}, in order
+ */
+inline list<rope> words( rope const& xs )
+{
+    return _rope_fields( []( std::string_view v, size_t from ){
+        for ( ; from < v.size(); ++from ) {
+            if ( std::isspace( static_cast<unsigned char>( v[from] ) ) ) { return from; }
+        }
+        return std::string_view::npos;
+    }, false, xs );
+}
+
+/**
+ * Inserts the characters of a rope into an output stream, a chunk at a time.
+ * @param os an output stream
+ * @param xs a rope
+ * @return a reference to the output stream
+ */
+inline std::ostream& operator<< ( std::ostream& os, rope const& xs )
+{
+    _rope_chunks( [&os]( std::string_view v ){ os.write( v.data(), v.size() ); return true; }, xs );
+    return os;
+}
+
+} // end namespace prelude
+
+#endif //HPP_PRELUDE_ROPE
@@ -0,0 +1,357 @@
+#ifndef HPP_PRELUDE_RUNS
+#define HPP_PRELUDE_RUNS
+
+#include <cstddef>
+#include <ostream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "List.hpp"
+
+/**
+ * Implementation of Haskell-like, functional programming idioms, particularly recursive lists.
+ */
+namespace prelude {
+
+/**
+ * Immutable, run-length encoded list. Each maximal stretch of equal elements is stored as a
+ * single (value, count) node of an ordinary list, so {@code replicate} and data with long
+ * constant stretches take memory proportional to the number of runs rather than elements.
+ * Consing an element equal to the head extends the first run; {@code tail} is an O(1) view
+ * that skips into the first run while sharing all runs with the original; {@code length} is
+ * O(1); {@code sum}, {@code drop} and indexing skip whole runs.
+ *
+ * @author Matthew A Johnson
+ * @version 1.0
+ */
+template <typename A>
+class runs
+{
+public:
+    using run = std::pair<A, size_t>;
+
+    /**
+     * Gets the element at the specified position of this list, skipping whole runs.
+     * @param i a zero-based index
+     * @return the element at position {@code i}
+     * @throws std::domain_error if {@code i} is not less than the length of this list
+     */
+    A const& operator[] ( size_t i ) const&
+    {
+        if ( i >= _length ) { PRELUDE_LIST_FAIL( "prelude::[]: index too large" ); }
+        i += _skip;
+        list_ref<run> rs = _runs;
+        while ( i >= head( rs ).second ) { i -= head( rs ).second; rs = tail( rs ); }
+        return head( rs ).first;
+    }
+
+    /**
+     * Gets the element at the specified position of a temporary list. The element is copied
+     * out, since the runs of this list may be freed at the end of the full-expression.
+     * @param i a zero-based index
+     * @return the element at position {@code i}
+     * @throws std::domain_error if {@code i} is not less than the length of this list
+     */
+    A operator[] ( size_t i ) && { return static_cast<runs const&>( *this )[i]; }
+
+private:
+    // The runs, in order; the first {@code _skip} elements of the first run are not part of this list.
+    list<run> _runs;
+    size_t    _skip;
+    size_t    _length;
+
+    runs( list<run> rs, size_t skip, size_t n ) : _runs( std::move( rs ) ), _skip( skip ), _length( n ) {}
+
+    template <typename B> friend runs<B> const& empty_runs();
+    template <typename B> friend runs<B> replicate( size_t, B );
+    template <typename B> friend runs<B> operator| ( B, runs<B> const& );
+    template <typename B> friend size_t length( runs<B> const& );
+    template <typename B> friend size_t run_count( runs<B> const& );
+    template <typename B> friend B const& head( runs<B> const& );
+    template <typename B> friend runs<B> tail( runs<B> const& );
+    template <typename B> friend runs<B> drop( size_t, runs<B> const& );
+    template <typename B> friend runs<B> take( size_t, runs<B> const& );
+    template <typename B> friend B sum( runs<B> const& );
+    template <typename F, typename B> friend auto map( F f, runs<B> const& xs )
+        -> runs<decltype( f( std::declval<B const&>() ) )>;
+    template <typename B> friend runs<B> encode( list_ref<B> );
+    template <typename B> friend list<B> to_list( runs<B> const& );
+    template <typename B> friend bool operator== ( runs<B> const&, runs<B> const& );
+};
+
+/**
+ * Typed empty run-length encoded list constant.
+ * @return the empty run-length encoded list of element type {@code A}
+ */
+template <typename A>
+inline runs<A> const& empty_runs() { static runs<A> const EMPTY( empty<typename runs<A>::run>(), 0, 0 ); return EMPTY; }
+
+/**
+ * Makes a list of one value repeated, as a single run.
+ * @param n the number of repetitions
+ * @param x an element
+ * @return a list of {@code n} copies of {@code x}
+ */
+template <typename A>
+inline runs<A> replicate( size_t n, A x )
+{
+    if ( n == 0 ) { return empty_runs<A>(); }
+    return runs<A>( list<typename runs<A>::run>( std::make_pair( std::move( x ), n ) ), 0, n );
+}
+
+/**
+ * Constructs a run-length encoded list by pre-pending an element. If the element equals the
+ * head of {@code xs} the first run is extended by one, otherwise a new run is started.
+ * @param x an element
+ * @param xs a run-length encoded list
+ * @return a list with {@code x} at the head and {@code xs} as the tail
+ */
+template <typename A>
+inline runs<A> operator| ( A x, runs<A> const& xs )
+{
+    using run = typename runs<A>::run;
+    if ( null( xs._runs ) ) { return replicate( 1, std::move( x ) ); }
+
+    auto const& first = head( xs._runs );
+    auto rest = tail( xs._runs );
+    auto left = first.second - xs._skip;
+    if ( first.first == x ) {
+        return runs<A>( run( std::move( x ), left + 1 ) | std::move( rest ), 0, xs._length + 1 );
+    }
+    auto rs = xs._skip ? run( first.first, left ) | std::move( rest ) : xs._runs;
+    return runs<A>( run( std::move( x ), 1 ) | std::move( rs ), 0, xs._length + 1 );
+}
+
+/**
+ * Constructs a run-length encoded list by pre-pending an element.
+ * @param x an element
+ * @param xs a run-length encoded list
+ * @return a list with {@code x} at the head and {@code xs} as the tail
+ */
+template <typename A>
+inline runs<A> cons( A x, runs<A> const& xs ) { return std::move( x ) | xs; }
+
+/**
+ * Test whether a run-length encoded list is empty.
+ * @param xs a run-length encoded list
+ * @return true if {@code xs} is empty, false otherwise
+ */
+template <typename A>
+inline bool null( runs<A> const& xs ) { return length( xs ) == 0; }
+
+/**
+ * Returns the length of a run-length encoded list in O(1).
+ * @param xs a run-length encoded list
+ * @return the number of elements in {@code xs}
+ */
+template <typename A>
+inline size_t length( runs<A> const& xs ) { return xs._length; }
+
+/**
+ * Returns the number of runs stored for a run-length encoded list.
+ * @param xs a run-length encoded list
+ * @return the number of (value, count) nodes making up {@code xs}
+ */
+template <typename A>
+inline size_t run_count( runs<A> const& xs ) { return length( xs._runs ); }
+
+/**
+ * Extract the first element of a run-length encoded list, which must be non-empty.
+ * @param xs a non-empty run-length encoded list
+ * @return the first element of {@code xs}
+ * @throws std::domain_error if {@code xs} is empty
+ */
+template <typename A>
+inline A const& head( runs<A> const& xs )
+{
+    if ( null( xs ) ) { PRELUDE_LIST_FAIL( "prelude::head: empty list" ); }
+    return head( list_ref<typename runs<A>::run>( xs._runs ) ).first;
+}
+
+/**
+ * Extract the first element of a temporary run-length encoded list, which must be non-empty.
+ * The element is copied out, since the runs of {@code xs} may be freed at the end of the
+ * full-expression.
+ * @param xs a non-empty run-length encoded list
+ * @return the first element of {@code xs}
+ * @throws std::domain_error if {@code xs} is empty
+ */
+template <typename A>
+inline A head( runs<A>&& xs ) { return head( static_cast<runs<A> const&>( xs ) ); }
+
+/**
+ * Extract the elements after the head of a run-length encoded list, in O(1). Within a run
+ * the result is a view sharing every run with {@code xs}.
+ * @param xs a non-empty run-length encoded list
+ * @return a list containing all but the first element of {@code xs}
+ * @throws std::domain_error if {@code xs} is empty
+ */
+template <typename A>
+inline runs<A> tail( runs<A> const& xs )
+{
+    if ( null( xs ) ) { PRELUDE_LIST_FAIL( "prelude::tail: empty list" ); }
+    return drop( 1, xs );
+}
+
+/**
+ * Gets what remains after removing a given number of elements, skipping whole runs.
+ * @param k a non-negative integer
+ * @param xs a run-length encoded list
+ * @return a sublist of {@code xs} with at most {@code length-k} elements
+ */
+template <typename A>
+inline runs<A> drop( size_t k, runs<A> const& xs )
+{
+    using run = typename runs<A>::run;
+    if ( k == 0 ) { return xs; }
+    if ( k >= xs._length ) { return empty_runs<A>(); }
+
+    auto n = xs._length - k;
+    k += xs._skip;
+    list_ref<run> rs = xs._runs;
+    while ( k >= head( rs ).second ) { k -= head( rs ).second; rs = tail( rs ); }
+    return runs<A>( rs.own(), k, n );
+}
+
+/**
+ * Gets the leading elements of a run-length encoded list, copying only the runs it covers.
+ * @param k a non-negative integer
+ * @param xs a run-length encoded list
+ * @return a sublist of {@code xs} with at most {@code k} elements
+ */
+template <typename A>
+inline runs<A> take( size_t k, runs<A> const& xs )
+{
+    using run = typename runs<A>::run;
+    if ( k >= xs._length ) { return xs; }
+    if ( k == 0 ) { return empty_runs<A>(); }
+
+    std::vector<run> trimmed;
+    auto skip = xs._skip;
+    auto left = k;
+    for ( list_ref<run> rs = xs._runs; left > 0; rs = tail( rs ) ) {
+        auto n = head( rs ).second - skip;
+        if ( n > left ) { n = left; }
+        trimmed.emplace_back( head( rs ).first, n );
+        left -= n;
+        skip = 0;
+    }
+    auto ys = empty<run>();
+    for ( auto r = trimmed.rbegin(); r != trimmed.rend(); ++r ) { ys = std::move( *r ) | std::move( ys ); }
+    return runs<A>( std::move( ys ), 0, k );
+}
+
+/**
+ * The {@code sum} function computes the sum of a run-length encoded list, one run at a time.
+ * @param xs a run-length encoded list
+ * @return the sum of each element of {@code xs}
+ */
+template <typename A>
+inline A sum( runs<A> const& xs )
+{
+    A result = 0;
+    auto skip = xs._skip;
+    for ( list_ref<typename runs<A>::run> rs = xs._runs; !null( rs ); rs = tail( rs ) ) {
+        result += head( rs ).first * static_cast<A>( head( rs ).second - skip );
+        skip = 0;
+    }
+    return result;
+}
+
+/**
+ * Applies a function once per run, coalescing neighbouring runs whose results are equal.
+ * @param f function that takes an element of {@code xs} and returns a different type
+ * @param xs a run-length encoded list
+ * @return a run-length encoded list of the results of {@code f}
+ */
+template <typename F, typename A>
+inline auto map( F f, runs<A> const& xs ) -> runs<decltype( f( std::declval<A const&>() ) )>
+{
+    using B = decltype( f( std::declval<A const&>() ) );
+    using run = typename runs<B>::run;
+    std::vector<run> ys;
+    auto skip = xs._skip;
+    for ( list_ref<typename runs<A>::run> rs = xs._runs; !null( rs ); rs = tail( rs ) ) {
+        auto y = f( head( rs ).first );
+        auto n = head( rs ).second - skip;
+        skip = 0;
+        if ( !ys.empty() && ys.back().first == y ) { ys.back().second += n; } else { ys.emplace_back( std::move( y ), n ); }
+    }
+    auto zs = empty<run>();
+    for ( auto r = ys.rbegin(); r != ys.rend(); ++r ) { zs = std::move( *r ) | std::move( zs ); }
+    return runs<B>( std::move( zs ), 0, xs._length );
+}
+
+/**
+ * Run-length encodes a list.
+ * @param xs a finite list or list view
+ * @return a run-length encoded list with the elements of {@code xs}
+ */
+template <typename A>
+inline runs<A> encode( list_ref<A> xs )
+{
+    using run = typename runs<A>::run;
+    std::vector<run> ys;
+    size_t n = 0;
+    for ( ; !null( xs ); xs = tail( xs ), ++n ) {
+        if ( !ys.empty() && ys.back().first == head( xs ) ) { ++ys.back().second; } else { ys.emplace_back( head( xs ), 1 ); }
+    }
+    auto zs = empty<run>();
+    for ( auto r = ys.rbegin(); r != ys.rend(); ++r ) { zs = std::move( *r ) | std::move( zs ); }
+    return runs<A>( std::move( zs ), 0, n );
+}
+
+/**
+ * Expands a run-length encoded list into an ordinary list.
+ * @param xs a run-length encoded list
+ * @return a list of the elements of {@code xs}, in order
+ */
+template <typename A>
+inline list<A> to_list( runs<A> const& xs )
+{
+    std::vector<typename runs<A>::run const*> rs;
+    for ( list_ref<typename runs<A>::run> r = xs._runs; !null( r ); r = tail( r ) ) { rs.push_back( &head( r ) ); }
+    auto ys = empty<A>();
+    for ( size_t i = rs.size(); i-- > 0; ) {
+        for ( auto n = rs[i]->second - ( i == 0 ? xs._skip : 0 ); n > 0; --n ) { ys = rs[i]->first | std::move( ys ); }
+    }
+    return ys;
+}
+
+/**
+ * Compares two run-length encoded lists element by element, one run at a time.
+ * @param xs a run-length encoded list
+ * @param ys a run-length encoded list
+ * @return true if {@code xs} and {@code ys} have equal elements in the same order
+ */
+template <typename A>
+inline bool operator== ( runs<A> const& xs, runs<A> const& ys )
+{
+    if ( xs._length != ys._length ) { return false; }
+    // Runs are maximal, so equal lists have equal runs once the skipped prefixes are discounted.
+    list_ref<typename runs<A>::run> r = xs._runs, s = ys._runs;
+    for ( bool first = true; !null( r ); r = tail( r ), s = tail( s ), first = false ) {
+        if ( !( head( r ).first == head( s ).first ) ) { return false; }
+        auto m = head( r ).second - ( first ? xs._skip : 0 );
+        auto n = head( s ).second - ( first ? ys._skip : 0 );
+        if ( m != n ) { return false; }
+    }
+    return true;
+}
+
+/**
+ * Inserts a character string serialization of a run-length encoded list into an output stream.
+ * @param os an output stream
+ * @param xs a run-length encoded list
+ * @return a reference to the output stream
+ */
+template <typename A>
+std::ostream& operator<< ( std::ostream& os, runs<A> const& xs )
+{
+    return os << to_list( xs );
+}
+
+} // end namespace prelude
+
+#endif //HPP_PRELUDE_RUNS
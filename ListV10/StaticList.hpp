@@ -0,0 +1,292 @@
+#ifndef HPP_PRELUDE_STATIC_LIST
+#define HPP_PRELUDE_STATIC_LIST
+
+#include <cstddef>
+#include <ostream>
+#include <stdexcept>
+
+#include "List.hpp"
+
+/**
+ * Implementation of Haskell-like, functional programming idioms, particularly recursive lists.
+ */
+namespace prelude {
+
+/**
+ * Family of immutable, fixed-capacity list types usable in constant expressions.
+ * A static list holds at most {@code N} elements inline, so lists declared
+ * {@code constexpr} are evaluated by the compiler and stored in the binary
+ * rather than being consed onto the heap at startup. The free functions below
+ * mirror those for {@code list<A>}; operations whose result length is not known
+ * until evaluation (e.g., {@code filter}, {@code take}) keep the capacity of
+ * their argument.
+ * Element types must be default-constructible literal types.
+ *
+ * @author Matthew A Johnson
+ * @version 1.0
+ */
+template <typename A, std::size_t N>
+class static_list
+{
+public:
+    /**
+     * Constructs an empty static list.
+     */
+    constexpr static_list() : _elems{}, _size( 0 ) {}
+    /**
+     * Constructs a static list from its elements, e.g., {@code static_list{ 2.0, 3.0, 4.0 }}.
+     * @param x  the first element
+     * @param xs the remaining elements
+     */
+    template <typename... As>
+    constexpr static_list( A x, As... xs ) : _elems{ x, static_cast<A>( xs )... }, _size( 1 + sizeof...( xs ) )
+        { static_assert( 1 + sizeof...( xs ) <= N, "prelude::static_list: too many elements" ); }
+
+    /**
+     * Gets the element at the specified position of this list.
+     * @param i a zero-based index
+     * @return the element at position {@code i}
+     * @throws std::domain_error if {@code i} is not less than the length of this list
+     */
+    constexpr A const& operator[] ( std::size_t i ) const
+    {
+        if ( i >= _size ) { throw std::domain_error("prelude::[]: index too large"); }
+        return _elems[i];
+    }
+    /**
+     * Casting operator permits type-conversion from list to boolean for use in test expressions.
+     */
+    constexpr explicit operator bool() const { return _size != 0; }
+
+    /** Capacity of this list type. */
+    static constexpr std::size_t capacity = N;
+
+private:
+    // Elements stored inline; only the first _size are part of the list.
+    A           _elems[N > 0 ? N : 1];
+    std::size_t _size;
+
+    /** Appends an element in place. For internal use only, while building a result. */
+    constexpr void snoc( A x ) { _elems[_size++] = x; }
+
+    template <typename B, std::size_t M> friend constexpr std::size_t length( static_list<B,M> const& );
+    template <typename B, std::size_t M> friend constexpr static_list<B,M> tail( static_list<B,M> const& );
+    template <typename F, typename B, std::size_t M> friend constexpr auto map( F, static_list<B,M> const& );
+    template <typename P, typename B, std::size_t M> friend constexpr static_list<B,M> filter( P, static_list<B,M> const& );
+    template <typename B, std::size_t M> friend constexpr static_list<B,M> take( std::size_t, static_list<B,M> const& );
+    template <typename B, std::size_t M> friend constexpr static_list<B,M> drop( std::size_t, static_list<B,M> const& );
+    template <typename B, std::size_t M> friend constexpr static_list<B,M> reverse( static_list<B,M> const& );
+    template <typename B, std::size_t M> friend constexpr static_list<B,M+1> cons( B, static_list<B,M> const& );
+    template <typename B, std::size_t M, std::size_t K>
+    friend constexpr static_list<B,M+K> operator+ ( static_list<B,M> const&, static_list<B,K> const& );
+    template <typename B, std::size_t M> friend class static_list;
+};
+
+/** Deduces the capacity of a static list from the number of elements given. */
+template <typename A, typename... As>
+static_list( A, As... ) -> static_list<A, 1 + sizeof...( As )>;
+
+/**
+ * Test whether a static list is empty.
+ * @param xs a static list
+ * @return true if {@code xs} is empty, false otherwise
+ */
+template <typename A, std::size_t N>
+constexpr bool null( static_list<A,N> const& xs ) { return !xs; }
+
+/**
+ * Returns the length of a static list. This operation has time complexity O(1).
+ * @param xs a static list
+ * @return the number of elements in {@code xs}
+ */
+template <typename A, std::size_t N>
+constexpr std::size_t length( static_list<A,N> const& xs ) { return xs._size; }
+
+/**
+ * Extract the first element of a static list, which must be non-empty.
+ * @param xs a non-empty static list
+ * @return the first element of {@code xs}
+ * @throws std::domain_error if {@code xs} is empty
+ */
+template <typename A, std::size_t N>
+constexpr A head( static_list<A,N> const& xs )
+{
+    if ( null( xs ) ) { throw std::domain_error("prelude::head: empty list"); }
+    return xs[0];
+}
+
+/**
+ * Extract the elements after the head of a static list, which must be non-empty.
+ * @param xs a non-empty static list
+ * @return a static list containing all but the first element of {@code xs}
+ * @throws std::domain_error if {@code xs} is empty
+ */
+template <typename A, std::size_t N>
+constexpr static_list<A,N> tail( static_list<A,N> const& xs )
+{
+    if ( null( xs ) ) { throw std::domain_error("prelude::tail: empty list"); }
+    return drop( 1, xs );
+}
+
+/**
+ * Constructs a static list by pre-pending an element to an existing static list.
+ * @param x an element
+ * @param xs a static list
+ * @return a static list with {@code x} at the head and {@code xs} as the tail
+ */
+template <typename A, std::size_t N>
+constexpr static_list<A,N+1> cons( A x, static_list<A,N> const& xs )
+{
+    static_list<A,N+1> ys;
+    ys.snoc( x );
+    for ( std::size_t i = 0; i < xs._size; ++i ) { ys.snoc( xs._elems[i] ); }
+    return ys;
+}
+
+/**
+ * Converts a static list of one type to that of another by applying a specified function.
+ * @param f function that takes an element of {@code xs} and returns a different type
+ * @param xs a static list
+ * @return a static list of elements the same type as the return type of {@code f}
+ */
+template <typename F, typename A, std::size_t N>
+constexpr auto map( F f, static_list<A,N> const& xs )
+{
+    static_list<decltype( f( xs._elems[0] ) ), N> ys;
+    for ( std::size_t i = 0; i < xs._size; ++i ) { ys.snoc( f( xs._elems[i] ) ); }
+    return ys;
+}
+
+/**
+ * {@code filter}, applied to a predicate and a static list, returns the static list of
+ * those elements that satisfy the predicate.
+ * @param pred a predicate function
+ * @param xs a static list
+ * @return a static list containing those elements of {@code xs} satisfying {@code pred}
+ */
+template <typename P, typename A, std::size_t N>
+constexpr static_list<A,N> filter( P pred, static_list<A,N> const& xs )
+{
+    static_list<A,N> ys;
+    for ( std::size_t i = 0; i < xs._size; ++i ) {
+        if ( pred( xs._elems[i] ) ) { ys.snoc( xs._elems[i] ); }
+    }
+    return ys;
+}
+
+/**
+ * Appends one static list to another.
+ * @param xs a static list
+ * @param ys a static list
+ * @return a static list in which the elements of {@code xs} precede the elements of {@code ys}
+ */
+template <typename A, std::size_t N, std::size_t M>
+constexpr static_list<A,N+M> operator+ ( static_list<A,N> const& xs, static_list<A,M> const& ys )
+{
+    static_list<A,N+M> zs;
+    for ( std::size_t i = 0; i < xs._size; ++i ) { zs.snoc( xs._elems[i] ); }
+    for ( std::size_t i = 0; i < ys._size; ++i ) { zs.snoc( ys._elems[i] ); }
+    return zs;
+}
+
+/**
+ * Reverses a static list.
+ * @param xs a static list
+ * @return a static list whose elements are the same as {@code xs} but in reverse order
+ */
+template <typename A, std::size_t N>
+constexpr static_list<A,N> reverse( static_list<A,N> const& xs )
+{
+    static_list<A,N> ys;
+    for ( std::size_t i = xs._size; i-- > 0; ) { ys.snoc( xs._elems[i] ); }
+    return ys;
+}
+
+/**
+ * The {@code sum} function computes the sum of a static list of numbers.
+ * @param xs a static list
+ * @return the sum of each element of {@code xs}
+ */
+template <typename A, std::size_t N>
+constexpr A sum( static_list<A,N> const& xs )
+{
+    A result = 0;
+    for ( std::size_t i = 0; i < length( xs ); ++i ) { result += xs[i]; }
+    return result;
+}
+
+/**
+ * Gets the leading sublist of a static list up to a given length.
+ * @param k a non-negative integer
+ * @param xs a static list
+ * @return a sublist of {@code xs} with at most {@code k} elements
+ */
+template <typename A, std::size_t N>
+constexpr static_list<A,N> take( std::size_t k, static_list<A,N> const& xs )
+{
+    static_list<A,N> ys;
+    for ( std::size_t i = 0; i < k && i < xs._size; ++i ) { ys.snoc( xs._elems[i] ); }
+    return ys;
+}
+
+/**
+ * Gets the trailing sublist of a static list after the given number of elements.
+ * @param k a non-negative integer
+ * @param xs a static list
+ * @return a sublist of {@code xs} without its first {@code k} elements
+ */
+template <typename A, std::size_t N>
+constexpr static_list<A,N> drop( std::size_t k, static_list<A,N> const& xs )
+{
+    static_list<A,N> ys;
+    for ( std::size_t i = k; i < xs._size; ++i ) { ys.snoc( xs._elems[i] ); }
+    return ys;
+}
+
+/**
+ * Element-wise equality of static lists, regardless of capacity.
+ */
+template <typename A, std::size_t N, std::size_t M>
+constexpr bool operator== ( static_list<A,N> const& xs, static_list<A,M> const& ys )
+{
+    if ( length( xs ) != length( ys ) ) { return false; }
+    for ( std::size_t i = 0; i < length( xs ); ++i ) {
+        if ( xs[i] != ys[i] ) { return false; }
+    }
+    return true;
+}
+
+/**
+ * Copies a static list into a heap-allocated {@code list}, e.g., to pass a compile-time
+ * table to code written against the dynamic list API.
+ * @param xs a static list
+ * @return a list with the same elements as {@code xs}
+ */
+template <typename A, std::size_t N>
+list<A> to_list( static_list<A,N> const& xs )
+{
+    auto ys = empty<A>();
+    for ( std::size_t i = length( xs ); i-- > 0; ) { ys = xs[i] | ys; }
+    return ys;
+}
+
+/**
+ * Inserts a character string serialization of a static list into an output stream.
+ * @param os an output stream
+ * @param xs a static list
+ * @return a reference to the output stream
+ */
+template <typename A, std::size_t N>
+std::ostream& operator<< ( std::ostream& os, static_list<A,N> const& xs )
+{
+    os << '[';
+    for ( std::size_t i = 0; i < length( xs ); ++i ) {
+        if ( i ) { os << ','; }
+        os << xs[i];
+    }
+    return os << ']';
+}
+
+} // end namespace prelude
+
+#endif //HPP_PRELUDE_STATIC_LIST
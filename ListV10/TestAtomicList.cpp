@@ -0,0 +1,96 @@
+#define PRELUDE_LIST_ATOMIC_REFS
+
+#include <cassert>
+#include <chrono>
+#include <forward_list>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "AtomicList.hpp"
+
+using namespace prelude;
+
+/** Mutex-guarded baseline with the same push/pop interface. */
+class locked_stack
+{
+public:
+    void push( long x ) { std::lock_guard<std::mutex> lock( _m ); _xs.push_front( x ); }
+    bool pop( long& x )
+    {
+        std::lock_guard<std::mutex> lock( _m );
+        if ( _xs.empty() ) { return false; }
+        x = _xs.front();
+        _xs.pop_front();
+        return true;
+    }
+private:
+    std::mutex             _m;
+    std::forward_list<long> _xs;
+};
+
+/**
+ * Each of t threads pushes its share of the values 1..t*n while popping as it goes,
+ * then drains; returns the elapsed seconds and checks every value was popped once.
+ */
+template <typename Push, typename Pop>
+double contend( int t, long n, Push push, Pop pop )
+{
+    std::vector<long> sums( t, 0 );
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (auto k = 0; k < t; ++k) {
+        workers.emplace_back( [=, &sums]{
+            long x, s = 0;
+            for (auto i = 1L; i <= n; ++i) {
+                push( k * n + i );
+                if ( i % 2 == 0 && pop( x ) ) { s += x; }
+            }
+            while ( pop( x ) ) { s += x; }
+            sums[k] = s;
+        } );
+    }
+    for (auto& w : workers) { w.join(); }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    long total = 0;
+    for (auto s : sums) { total += s; }
+    assert( total == t * n * (t * n + 1) / 2 );
+    return elapsed.count();
+}
+
+int main(int argc, char** argv)
+{
+    auto t = argc > 1 ? std::stoi(argv[1]) : 4;
+    auto n = argc > 2 ? std::stol(argv[2]) : 100000L;
+
+    atomic_list<int> xs;
+    assert( null( xs.snapshot() ) );
+    xs.push( 3 ); xs.push( 2 ); xs.push( 1 );
+    auto ys = xs.snapshot();
+    assert( ys == (list<int>{ 1, 2, 3 }) );
+    assert( *xs.pop() == 1 );
+    assert( ys == (list<int>{ 1, 2, 3 }) );
+    auto zs = empty<int>();
+    assert( !xs.compare_exchange( zs, list<int>{ 9 } ) );
+    assert( zs == (list<int>{ 2, 3 }) );
+    assert( xs.compare_exchange( zs, list<int>{ 9 } ) );
+    assert( *xs.pop() == 9 );
+    assert( !xs.pop() );
+
+    atomic_list<long> stack;
+    auto lock_free = contend( t, n,
+        [&stack](long x){ stack.push( x ); },
+        [&stack](long& x){ auto y = stack.pop(); if ( y ) { x = *y; } return bool( y ); } );
+
+    locked_stack baseline;
+    auto locked = contend( t, n,
+        [&baseline](long x){ baseline.push( x ); },
+        [&baseline](long& x){ return baseline.pop( x ); } );
+
+    std::cout << "atomic_list:       " << lock_free << "s" << std::endl;
+    std::cout << "mutex forward_list: " << locked << "s" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,95 @@
+#include <cassert>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "List.hpp"
+#include "Timing.hpp"
+
+using namespace prelude;
+
+/** The TestList workload: build [1..n], then sum m maps of it. */
+template <typename L>
+float workload( int n, int m, L xs )
+{
+    for (auto i = n; i >= 1; --i) { xs = i | std::move( xs ); }
+    auto z = 0.f;
+    for (auto j = 2.f; j <= m + 1.f; ++j ) {
+        z += sum( map( [j](int x)->float{ return x / j; }, xs ) );
+    }
+    return z;
+}
+
+/** The list operations behave alike under every policy, and results outlive their arguments. */
+template <typename O, typename A>
+void behaviour()
+{
+    using ints = basic_list<int, O, A>;
+    using strings = basic_list<std::string, O, A>;
+
+    ints xs{ 1, 2, 3, 4, 5 };
+    assert( length( xs ) == 5 && head( xs ) == 1 && sum( xs ) == 15 );
+    assert( tail( xs ) == ( ints{ 2, 3, 4, 5 } ) && null( tail( ints{ 1 } ) ) );
+    assert( take( 2, xs ) == ( ints{ 1, 2 } ) && null( take( 0, xs ) ) && take( 9, xs ) == xs );
+    assert( drop( 2, xs ) == ( ints{ 3, 4, 5 } ) && drop( 0, xs ) == xs && null( drop( 9, xs ) ) );
+    assert( reverse( xs ) == ( ints{ 5, 4, 3, 2, 1 } ) && null( reverse( ints() ) ) );
+    assert( filter( [](int x){ return x % 2; }, xs ) == ( ints{ 1, 3, 5 } ) );
+    assert( take( 2, xs ) + drop( 2, xs ) == xs && xs + ints() == xs && ints() + xs == xs );
+    assert( foldl( [](int a, int x){ return 10 * a + x; }, 0, xs ) == 12345 );
+    assert( map( [](int x){ return x * x; }, xs ) == ( ints{ 1, 4, 9, 16, 25 } ) );
+    assert( !( xs == tail( xs ) ) && !( take( 4, xs ) == xs ) && ints() == ints() );
+    try { head( ints() ); assert( false ); } catch ( std::domain_error const& ) {}
+    try { tail( ints() ); assert( false ); } catch ( std::domain_error const& ) {}
+
+    // Tails, prefixes, suffixes and copies stay intact once their source is gone, whether they
+    // share its nodes or (unique_ownership) copy them; strings make a dangling node visible to ASan.
+    strings ws, ts, ps, ds, cs;
+    {
+        strings ss{ "alpha", "beta", "gamma", "delta" };
+        ws = std::string( "omega" ) | ss;
+        ts = tail( ss );
+        ps = take( 2, ss );
+        ds = drop( 3, ss );
+        cs = ss;
+    }
+    assert( ws == ( strings{ "omega", "alpha", "beta", "gamma", "delta" } ) && tail( ws ) == cs );
+    assert( ts == ( strings{ "beta", "gamma", "delta" } ) && ps == ( strings{ "alpha", "beta" } ) );
+    assert( ds == strings{ "delta" } && cs + ws == reverse( reverse( cs + ws ) ) );
+    std::ostringstream oss;
+    oss << ps;
+    assert( oss.str() == "[alpha,beta]" );
+}
+
+template <typename O, typename A>
+float run( char const* name, int n, int m )
+{
+    behaviour<O, A>();
+    float z = 0;
+    auto t = seconds( [&]{ z = workload( n, m, basic_list<int, O, A>() ); } );
+    std::cout << std::left << std::setw( 40 ) << name << t << "s" << std::endl;
+    return z;
+}
+
+int main(int argc, char** argv)
+{
+    auto n = argc > 1 ? std::stoi(argv[1]) : 10000;
+    auto m = argc > 2 ? std::stoi(argv[2]) : 1000;
+
+    static_assert( std::is_same<basic_list<int>, list<int>>::value, "list is the default basic_list" );
+
+    // Braced initialisation runs the policies in order, each checked against list's result.
+    auto expected = run<intrusive_ownership, new_alloc>( "list (intrusive_ownership, new_alloc)", n, m );
+    for ( auto z : { run<intrusive_ownership, pool_alloc>( "intrusive_ownership, pool_alloc", n, m ),
+                     run<shared_ownership, new_alloc>( "shared_ownership, new_alloc", n, m ),
+                     run<shared_ownership, pool_alloc>( "shared_ownership, pool_alloc", n, m ),
+                     run<unique_ownership, new_alloc>( "unique_ownership, new_alloc", n, m ),
+                     run<unique_ownership, pool_alloc>( "unique_ownership, pool_alloc", n, m ) } ) {
+        assert( z == expected );
+        (void) z;
+    }
+
+    return 0;
+}
@@ -0,0 +1,65 @@
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "Bits.hpp"
+#include "Timing.hpp"
+
+using namespace prelude;
+
+int main(int argc, char** argv)
+{
+    auto n = argc > 1 ? std::stoi(argv[1]) : 10000000;
+    auto m = argc > 2 ? std::stoi(argv[2]) : 8;
+
+    // Chunk boundaries, unaligned views and unpacked fronts all agree with list<bool>.
+    std::srand( 5 );
+    auto bs = empty<bool>(), cs = empty<bool>();
+    for (auto i = 0; i < 1500; ++i) {
+        bs = ( std::rand() % 3 == 0 ) | bs;
+        cs = ( std::rand() % 2 == 0 ) | cs;
+    }
+    auto count = []( list<bool> const& xs ){ return length( filter( []( bool x ){ return x; }, xs ) ); };
+    auto xs = to_bits( bs ), ys = to_bits( cs );
+    assert( length( xs ) == 1500 && to_list( xs ) == bs && sum( xs ) == count( bs ) );
+    for (unsigned k : { 0u, 1u, 63u, 64u, 65u, 511u, 512u, 513u, 1000u, 1499u, 1500u }) {
+        auto dx = drop( k, xs ), dy = drop( ( k * 7 ) % 1500, ys );
+        assert( to_list( dx ) == drop( k, bs ) && sum( dx ) == count( drop( k, bs ) ) );
+        if ( k < 1500 ) { assert( head( dx ) == head( drop( k, bs ) ) ); }
+        auto ex = true | ( false | dx );
+        auto ey = drop( ( k * 7 ) % 1500, cs );
+        assert( to_list( ex & dy ) == zipWith( []( bool a, bool b ){ return a && b; }, true | ( false | drop( k, bs ) ), ey ) );
+        assert( to_list( ex | dy ) == zipWith( []( bool a, bool b ){ return a || b; }, true | ( false | drop( k, bs ) ), ey ) );
+        assert( to_list( zipWith( []( bool a, bool b ){ return a != b; }, ex, dy ) )
+                == zipWith( []( bool a, bool b ){ return a != b; }, true | ( false | drop( k, bs ) ), ey ) );
+        assert( sum( ~ex ) == length( ex ) - sum( ex ) && to_bits( to_list( ex ) ) == ex );
+    }
+    auto is = indices( xs );
+    assert( length( is ) == sum( xs ) && and_( map( [&bs]( size_t i ){ return bs[i]; }, is ) ) );
+    assert( and_( to_bits( list<bool>{ true, true } ) ) && !and_( to_bits( list<bool>{ true, false } ) ) );
+    assert( or_( to_bits( list<bool>{ false, true } ) ) && !or_( to_bits( empty<bool>() ) ) );
+    assert( null( tail( to_bits( list<bool>{ true } ) ) ) && sum( drop( 3, xs ) ) == sum( tail( tail( tail( xs ) ) ) ) );
+
+    // The masks of TestListFilter, counted through filtered lists and by popcount.
+    auto zs = empty<int>();
+    for (auto i = n; i >= 1; --i) { zs = i | zs; }
+    size_t by_list = 0, by_bits = 0, both_list = 0, both_bits = 0;
+    auto t_list = seconds( [&]{
+        for (auto j = 2; j <= m; ++j) { by_list += length( filter( [j](int x){ return x % j == 0; }, zs ) ); }
+        both_list = length( filter( [](int x){ return x % 2 == 0 && x % 3 == 0; }, zs ) );
+    } );
+    auto t_bits = seconds( [&]{
+        for (auto j = 2; j <= m; ++j) { by_bits += sum( mask( [j](int x){ return x % j == 0; }, zs ) ); }
+        both_bits = sum( mask( [](int x){ return x % 2 == 0; }, zs ) & mask( [](int x){ return x % 3 == 0; }, zs ) );
+    } );
+    assert( by_list == by_bits && both_list == both_bits );
+    auto evens = mask( [](int x){ return x % 2 == 0; }, zs );
+    assert( select( evens, take( 100, zs ) ) == filter( [](int x){ return x % 2 == 0; }, take( 100, zs ) ) );
+    assert( length( indices( evens ) ) == length( zs ) / 2 && head( indices( evens ) ) == 1 );
+
+    std::cout << "filter + length: " << t_list << " s" << std::endl;
+    std::cout << "mask + popcount: " << t_bits << " s" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,50 @@
+#include <cassert>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <tuple>
+
+#include "Columns.hpp"
+#include "Timing.hpp"
+
+using namespace prelude;
+
+int main(int argc, char** argv)
+{
+    auto n = argc > 1 ? std::stoi(argv[1]) : 1000000;
+
+    list<float> xs { 1, 2, 3 };
+    list<int> ks { 10, 20, 30, 40 };
+    auto cs = zip_columns( xs, ks );
+    assert( length( cs ) == 3 && !null( cs ) );
+    assert( to_list( cs ) == (list<std::tuple<float,int>>{ { 1.f, 10 }, { 2.f, 20 }, { 3.f, 30 } }) );
+    assert( to_list( column<0>( cs ) ) == xs );
+    assert( sum( column<1>( cs ) ) == 60 );
+    assert( sum( map( [](float x){ return x * 2; }, column<0>( cs ) ) ) == 12.f );
+    assert( to_list( zipWith( std::plus<float>(), column<0>( cs ), map( [](int k){ return float( k ); }, column<1>( cs ) ) ) )
+            == (list<float>{ 11, 22, 33 }) );
+    assert( null( zip_columns( xs, empty<int>() ) ) && null( to_list( zip_columns( empty<int>() ) ) ) );
+
+    // Two series spanning several chunks, zipped as array-of-structs and as columns.
+    auto as = empty<float>(), bs = empty<float>();
+    for (auto i = n; i-- > 0;) { as = float( i % 7 ) | as; bs = float( i % 5 ) | bs; }
+
+    // Both sides build their representation inside the timed call and keep it alive outside.
+    float aos = 0, soa = 0;
+    auto ps = empty<std::pair<float,float>>();
+    auto aos_time = seconds( [&]{
+        ps = zip( as, bs );
+        aos = sum( map( [](std::pair<float,float> const& p){ return p.first * p.second; }, ps ) );
+    } );
+    auto ss = zip_columns( empty<float>(), empty<float>() );
+    auto soa_time = seconds( [&]{
+        ss = zip_columns( as, bs );
+        soa = sum( zipWith( std::multiplies<float>(), column<0>( ss ), column<1>( ss ) ) );
+    } );
+    assert( length( ps ) == size_t( n ) && length( ss ) == size_t( n ) && to_list( column<1>( ss ) ) == bs );
+    assert( sum( zipWith( std::multiplies<float>(), as, bs ) ) == aos );
+    std::cout << "dot product of " << n << " pairs: zip/map/sum " << aos_time << "s ("
+              << aos << "), columns " << soa_time << "s (" << soa << ")" << std::endl;
+
+    return 0;
+}
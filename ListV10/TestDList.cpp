@@ -0,0 +1,49 @@
+#include <cassert>
+#include <iostream>
+#include <string>
+
+#include "DList.hpp"
+#include "Timing.hpp"
+
+using namespace prelude;
+
+int main(int argc, char** argv)
+{
+    auto n = argc > 1 ? std::stoi(argv[1]) : 1000000;
+
+    auto xs = list<int>{ 3, 4 }, ys = list<int>{ 6, 7 };
+    auto ds = snoc( 1 | ( ( 2 | ( dlist<int>( xs ) + dlist<int>() ) ) + ( 5 | dlist<int>( ys ) ) ), 8 );
+    assert( to_list( ds ) == ( list<int>{ 1, 2, 3, 4, 5, 6, 7, 8 } ) && length( ds ) == 8 );
+    assert( foldl( []( int a, int x ){ return a * 10 + x; }, 0, ds ) == 12345678 );
+    assert( to_list( concat( list<dlist<int>>{ ds, dlist<int>(), dlist<int>( xs ) } ) ) == to_list( ds ) + xs );
+    assert( null( dlist<int>() ) && null( to_list( dlist<int>() ) ) && !null( ds ) );
+    assert( to_list( dlist<int>( xs ) ) == xs && to_list( cons( 0, dlist<int>() ) ) == list<int>{ 0 } );
+    assert( to_list( snoc( dlist<int>(), 9 ) ) == list<int>{ 9 } );
+
+    // The result owns its nodes, so extending it in place leaves the pieces alone.
+    auto zs = to_list( dlist<int>( list<int>{ 1 } ) + dlist<int>( ys ) ) + xs;
+    assert( zs == ( list<int>{ 1, 6, 7, 3, 4 } ) && ys == ( list<int>{ 6, 7 } ) );
+
+    // Incremental appends: list + copies its left operand each time, dlist snoc does not.
+    for (auto m = n / 512; m <= n; m *= 4) {
+        auto linked = empty<int>();
+        auto t_dlist = seconds( [&]{
+            auto acc = dlist<int>();
+            for (auto i = 0; i < m; ++i) { acc = snoc( acc, i ); }
+            linked = to_list( acc );
+        } );
+        assert( length( linked ) == size_t( m ) );
+        std::cout << "appends: " << m << ", dlist: " << t_dlist << " s";
+        if ( m <= n / 64 ) {
+            auto acc = empty<int>();
+            auto t_list = seconds( [&]{
+                for (auto i = 0; i < m; ++i) { acc = acc + ( i | empty<int>() ); }
+            } );
+            assert( length( acc ) == size_t( m ) && acc == linked );
+            std::cout << ", list: " << t_list << " s";
+        }
+        std::cout << std::endl;
+    }
+
+    return 0;
+}
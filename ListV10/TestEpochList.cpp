@@ -0,0 +1,78 @@
+#define PRELUDE_LIST_ATOMIC_REFS
+
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "EpochList.hpp"
+
+using namespace prelude;
+
+/**
+ * Runs t reader threads, each summing the shared list r times, while one writer keeps
+ * publishing new versions; returns the elapsed seconds.
+ */
+template <typename Read>
+double readers( int t, int r, shared_list<long>& shared, Read read )
+{
+    std::atomic<bool> done( false );
+    std::thread writer( [&]{
+        auto xs = shared.snapshot();
+        while ( !done ) { shared.publish( xs = 0L | xs ); shared.publish( xs = tail( xs ) ); }
+    } );
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (auto k = 0; k < t; ++k) {
+        workers.emplace_back( [&]{ for (auto i = 0; i < r; ++i) { read(); } } );
+    }
+    for (auto& w : workers) { w.join(); }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    done = true;
+    writer.join();
+    return elapsed.count();
+}
+
+int main(int argc, char** argv)
+{
+    auto n = argc > 1 ? std::stol(argv[1]) : 100000L;
+    auto r = argc > 2 ? std::stoi(argv[2]) : 20;
+    auto tmax = argc > 3 ? std::stoi(argv[3]) : 64;
+
+    shared_list<int> xs( list<int>{ 1, 2, 3 } );
+    {
+        epoch_guard g;
+        auto v = xs.read( g );
+        xs.publish( list<int>{ 4, 5 } );
+        assert( sum( v ) == 6 && length( v ) == 3 && head( tail( v ) ) == 2 );
+        assert( sum( xs.read( g ) ) == 9 );
+    }
+    assert( xs.snapshot() == (list<int>{ 4, 5 }) );
+
+    auto ys = empty<long>();
+    for (auto i = n; i >= 1; --i) { ys = i | ys; }
+    shared_list<long> shared( ys );
+    auto expected = sum( ys );
+
+    std::cout << "threads  epoch_view  atomic_refcount" << std::endl;
+    for (auto t = 1; t <= tmax; t *= 2) {
+        auto epoch = readers( t, r, shared, [&]{
+            epoch_guard g;
+            auto s = sum( shared.read( g ) );
+            assert( s == expected );
+            (void) s;
+        } );
+        auto counted = readers( t, r, shared, [&]{
+            long s = 0;
+            for (auto zs = shared.snapshot(); !null( zs ); zs = tail( zs )) { s += head( zs ); }
+            assert( s == expected );
+            (void) s;
+        } );
+        std::cout << t << "  " << epoch << "s  " << counted << "s" << std::endl;
+    }
+
+    return 0;
+}
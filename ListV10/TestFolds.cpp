@@ -0,0 +1,29 @@
+#include <cassert>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include "List.hpp"
+
+using namespace prelude;
+
+int main(int argc, char** argv)
+{
+    auto n = std::stoi(argv[1]);
+
+    list<long> xs = cons( long( n ), empty<long>() );
+    for (auto i = long( n - 1 ); i >= 1; --i) {
+        xs = i | xs;
+    }
+
+    // Each of these walked the list recursively before and overflowed the stack on long lists.
+    assert( last( xs ) == n );
+    assert( length( init( xs ) ) == size_t( n - 1 ) );
+    assert( foldr( [](long x, long acc){ return x + acc; }, 0L, xs ) == sum( xs ) );
+    assert( fold_parallel( std::plus<long>(), 0L, xs ) == sum( xs ) );
+    assert( maximum( xs ) == n && minimum( xs ) == 1 );
+    assert( last( scanl( std::plus<long>(), 0L, xs ) ) == sum( xs ) );
+
+    std::cout << std::setprecision(12) << fold_parallel( std::plus<long>(), 0L, xs ) << std::endl;
+
+    return 0;
+}
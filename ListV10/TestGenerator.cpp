@@ -0,0 +1,79 @@
+#include <cassert>
+#include <stdexcept>
+
+#include "Generator.hpp"
+
+using namespace prelude;
+
+generator<int> enumerate( int from, int to )
+{
+    for ( auto i = from; i <= to; ++i ) { co_yield i; }
+}
+
+generator<int> counted( int& pulls )
+{
+    for ( auto i = 1; ; ++i ) { ++pulls; co_yield i; }
+}
+
+generator<int> failing()
+{
+    co_yield 1;
+    throw std::runtime_error("producer failed");
+}
+
+int main()
+{
+    auto naturals = [](){ return iterate( [](long x){ return x + 1; }, 1L ); };
+
+    assert( take( 5, naturals() ) == (list<long>{ 1, 2, 3, 4, 5 }) );
+    assert( null( take( 0, naturals() ) ) );
+
+    auto odds = filter( [](long x){ return x % 2 == 1; }, naturals() );
+    auto squares = map( [](long x){ return x * x; }, std::move( odds ) );
+    assert( take( 3, std::move( squares ) ) == (list<long>{ 1, 9, 25 }) );
+
+    assert( to_list( enumerate( 1, 4 ) ) == (list<int>{ 1, 2, 3, 4 }) );
+    assert( null( to_list( enumerate( 1, 0 ) ) ) );
+    assert( take( 10, enumerate( 1, 3 ) ) == (list<int>{ 1, 2, 3 }) );
+    assert( sum( enumerate( 1, 100 ) ) == 5050 );
+
+    list<double> xs { 2.0, 3.0, 4.0 };
+    assert( to_list( to_generator( xs ) ) == xs );
+    assert( sum( map( [](double x){ return x / 2; }, to_generator( xs ) ) ) == 4.5 );
+    assert( null( to_list( to_generator( empty<double>() ) ) ) );
+
+    bool thrown = false;
+    try { to_list( failing() ); } catch ( std::runtime_error const& ) { thrown = true; }
+    assert( thrown );
+
+    // Lazy lists produce each element once, when first reached, and share it between copies.
+    auto pulls = 0;
+    auto ns = lift( counted( pulls ) );
+    assert( pulls == 1 && head( ns ) == 1 );
+    assert( take( 3, ns ) == (list<int>{ 1, 2, 3 }) && pulls == 3 );
+    auto rest = drop( 2, ns );
+    assert( head( rest ) == 3 && pulls == 3 );
+    assert( head( tail( rest ) ) == 4 && pulls == 4 );
+    assert( take( 4, ns ) == (list<int>{ 1, 2, 3, 4 }) && pulls == 4 );
+    assert( null( take( 0, counted( pulls ) ) ) && pulls == 4 );
+    assert( head( lift( counted( pulls ) ) ) == 1 );
+
+    assert( to_list( lift( enumerate( 1, 4 ) ) ) == (list<int>{ 1, 2, 3, 4 }) );
+    assert( null( lift( enumerate( 1, 0 ) ) ) && null( drop( 5, lift( enumerate( 1, 3 ) ) ) ) );
+    assert( sum( to_generator( drop( 1, lift( enumerate( 1, 100 ) ) ) ) ) == 5049 );
+    auto evens = lift( filter( [](long x){ return x % 2 == 0; }, naturals() ) );
+    assert( take( 3, map( [](long x){ return x * x; }, to_generator( evens ) ) ) == (list<long>{ 4, 16, 36 }) );
+    assert( take( 2, evens ) == (list<long>{ 2, 4 }) );
+
+    // A long lazy list is freed node by node, without recursion, once nothing can reach it.
+    auto big = lift( enumerate( 1, 1000000 ) );
+    assert( length( to_list( big ) ) == 1000000 );
+    big = lazy_list<int>();
+
+    thrown = false;
+    auto fs = lift( failing() );
+    try { tail( fs ); } catch ( std::runtime_error const& ) { thrown = true; }
+    assert( thrown && head( fs ) == 1 && null( tail( fs ) ) );
+
+    return 0;
+}
@@ -0,0 +1,105 @@
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+
+#include "HashMap.hpp"
+#include "Timing.hpp"
+
+using namespace prelude;
+
+/** Hash sending every key to one of two buckets, to force collision nodes. */
+struct bad_hash { std::size_t operator() ( int k ) const { return k % 2; } };
+
+/** Linear lookup in an association list, as production code does today. */
+template <typename K, typename V>
+maybe<V> assoc_lookup( K const& k, list<std::pair<K,V>> const& xs )
+{
+    for ( auto ys = xs; !null( ys ); ys = tail( ys ) ) {
+        auto e = head( ys );
+        if ( e.first == k ) { return just( e.second ); }
+    }
+    return nothing<V>();
+}
+
+int main(int argc, char** argv)
+{
+    auto n = argc > 1 ? std::stoi(argv[1]) : 10000;
+    auto m = argc > 2 ? std::stoi(argv[2]) : 1000;
+
+    hash_map<std::string, int> ages { { "ada", 36 }, { "alan", 41 }, { "grace", 85 } };
+    assert( length( ages ) == 3 && *lookup( std::string("alan"), ages ) == 41 );
+    auto older = insert( std::string("alan"), 42, ages );
+    assert( *lookup( std::string("alan"), older ) == 42 && *lookup( std::string("alan"), ages ) == 41 );
+    assert( length( older ) == 3 );
+    auto fewer = erase( std::string("ada"), ages );
+    assert( length( fewer ) == 2 && !member( std::string("ada"), fewer ) && member( std::string("ada"), ages ) );
+    assert( null( erase( std::string("x"), hash_map<std::string, int>() ) ) );
+
+    // Large map against a reference, including deletions and forced collisions.
+    hash_map<int, int> xs;
+    hash_map<int, int, bad_hash> cs;
+    std::unordered_map<int, int> ref;
+    std::srand( 7 );
+    for (auto i = 0; i < 20000; ++i) {
+        auto k = std::rand() % 5000;
+        if ( std::rand() % 3 ) {
+            xs = insert( k, i, xs );
+            if ( k < 200 ) { cs = insert( k, i, cs ); }
+            ref[k] = i;
+        } else {
+            xs = erase( k, xs );
+            if ( k < 200 ) { cs = erase( k, cs ); }
+            ref.erase( k );
+        }
+    }
+    assert( length( xs ) == ref.size() );
+    for (auto k = 0; k < 5000; ++k) {
+        auto v = lookup( k, xs );
+        assert( v.has_value() == ( ref.count( k ) == 1 ) );
+        if ( v ) { assert( *v == ref[k] ); }
+        if ( k < 200 ) {
+            auto c = lookup( k, cs );
+            assert( c.has_value() == v.has_value() && ( !c || *c == *v ) );
+        }
+    }
+    auto ys = from_list( to_list( xs ) );
+    assert( length( ys ) == length( xs ) && length( to_list( xs ) ) == ref.size() );
+    for (auto const& e : ref) { assert( *lookup( e.first, ys ) == e.second ); }
+    while ( !null( ys ) ) { ys = erase( head( to_list( ys ) ).first, ys ); }
+
+    // Benchmark: m versions, each one update followed by m lookups.
+    auto pairs = empty<std::pair<int, int>>();
+    hash_map<int, int> hamt;
+    std::unordered_map<int, int> table;
+    for (auto i = 0; i < n; ++i) {
+        pairs = std::make_pair( i, i ) | pairs;
+        hamt = insert( i, i, hamt );
+        table[i] = i;
+    }
+    long z1 = 0, z2 = 0, z3 = 0;
+    auto t1 = seconds( [&]{
+        for (auto j = 0; j < m; ++j) {
+            auto v = insert( j % n, -j, hamt );
+            for (auto k = 0; k < m; ++k) { z1 += *lookup( ( k * 7919 ) % n, v ); }
+        } } );
+    auto t2 = seconds( [&]{
+        for (auto j = 0; j < m; ++j) {
+            auto v = std::make_pair( j % n, -j ) | pairs;
+            for (auto k = 0; k < m; ++k) { z2 += *assoc_lookup( ( k * 7919 ) % n, v ); }
+        } } );
+    auto t3 = seconds( [&]{
+        for (auto j = 0; j < m; ++j) {
+            auto v = table;
+            v[j % n] = -j;
+            for (auto k = 0; k < m; ++k) { z3 += v.at( ( k * 7919 ) % n ); }
+        } } );
+    assert( z1 == z2 && z2 == z3 );
+
+    std::cout << "hash_map:                 " << t1 << "s" << std::endl;
+    std::cout << "list<pair> linear lookup: " << t2 << "s" << std::endl;
+    std::cout << "unordered_map copy:       " << t3 << "s" << std::endl;
+
+    return 0;
+}
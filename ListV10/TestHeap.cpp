@@ -0,0 +1,104 @@
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <queue>
+#include <string>
+#include <vector>
+
+#include "Heap.hpp"
+#include "Timing.hpp"
+
+using namespace prelude;
+
+template <typename A>
+list<A> from_vector( std::vector<A> const& v )
+{
+    auto xs = empty<A>();
+    for (auto x = v.rbegin(); x != v.rend(); ++x) { xs = *x | xs; }
+    return xs;
+}
+
+int main(int argc, char** argv)
+{
+    auto n = argc > 1 ? std::stoi(argv[1]) : 1000000;
+    auto k = argc > 2 ? std::stoi(argv[2]) : 100;
+
+    auto h = insert( 5, insert( 1, insert( 3, heap<int>() ) ) );
+    assert( findMin( h ) == 1 && length( h ) == 3 && findMin( deleteMin( h ) ) == 3 );
+    assert( to_sorted_list( merge( h, insert( 2, heap<int>() ) ) ) == ( list<int>{ 1, 2, 3, 5 } ) );
+    assert( to_sorted_list( h ) == ( list<int>{ 1, 3, 5 } ) && null( heap<int>() ) && null( deleteMin( insert( 0, heap<int>() ) ) ) );
+    try { findMin( heap<int>() ); assert( false ); } catch ( std::domain_error const& ) {}
+
+    // Temporaries give values: nothing may point into trees freed at the end of the statement.
+    auto const& m = findMin( insert( std::string( 40, 'm' ), heap<std::string>() ) );
+    assert( m == std::string( 40, 'm' ) );
+
+    // Random operations on saved versions agree with sorted vectors.
+    std::srand( 23 );
+    std::vector<std::pair<heap<int>, std::vector<int>>> hs{ { heap<int>(), {} } };
+    for (auto i = 0; i < 3000; ++i) {
+        auto v = hs[std::rand() % hs.size()];
+        switch ( std::rand() % 4 ) {
+        case 0: if ( !v.second.empty() ) { v.first = deleteMin( v.first ); v.second.erase( v.second.begin() ); } break;
+        case 1: { auto const& w = hs[std::rand() % hs.size()]; v.first = merge( v.first, w.first ); v.second.insert( v.second.end(), w.second.begin(), w.second.end() ); break; }
+        default: { auto x = std::rand() % 1000; v.first = insert( x, v.first ); v.second.push_back( x ); break; }
+        }
+        std::sort( v.second.begin(), v.second.end() );
+        assert( length( v.first ) == v.second.size() );
+        if ( !v.second.empty() ) { assert( findMin( v.first ) == v.second.front() ); }
+        hs.push_back( v );
+    }
+    for (auto i = 0; i < 100; ++i) {
+        auto const& v = hs[std::rand() % hs.size()];
+        assert( to_sorted_list( v.first ) == from_vector( v.second ) );
+    }
+
+    // Decreasing insertions make a tree as deep as it is large; dropping it must not overflow the stack.
+    {
+        auto deep = heap<int>();
+        for (auto i = n; i > 0; --i) { deep = insert( i, deep ); }
+        assert( findMin( deep ) == 1 );
+    }
+
+    // Bounds must survive persistence: deleting from one shared version, again and again,
+    // costs the same each time, here after increasing insertions.
+    auto shared = heap<int>();
+    for (auto i = 0; i < n; ++i) { shared = insert( i, shared ); }
+    auto t_shared = seconds( [&]{
+        for (auto i = 0; i < k; ++i) { assert( findMin( deleteMin( shared ) ) == 1 ); }
+    } );
+    assert( length( shared ) == size_t( n ) && findMin( shared ) == 0 );
+
+    // Top-k of n values: heapify and k deletions, against a full sort and std::priority_queue.
+    std::vector<int> v( n );
+    for (auto& x : v) { x = std::rand(); }
+    auto xs = from_vector( v );
+    auto top = empty<int>();
+    std::vector<int> top_sort, top_std;
+    auto t_heap = seconds( [&]{
+        auto hp = from_list( xs );
+        auto ys = empty<int>();
+        for (auto i = 0; i < k; ++i) { ys = findMin( hp ) | ys; hp = deleteMin( hp ); }
+        top = reverse( ys );
+    } );
+    auto t_sort = seconds( [&]{
+        auto w = v;
+        std::sort( w.begin(), w.end() );
+        top_sort.assign( w.begin(), w.begin() + k );
+    } );
+    auto t_std = seconds( [&]{
+        std::priority_queue<int, std::vector<int>, std::greater<int>> pq( v.begin(), v.end() );
+        for (auto i = 0; i < k; ++i) { top_std.push_back( pq.top() ); pq.pop(); }
+    } );
+    assert( top == from_vector( top_sort ) && top_sort == top_std );
+    assert( to_sorted_list( from_list( take( 1000, xs ) ) ) == sortOn( []( int x ){ return x; }, take( 1000, xs ) ) );
+
+    std::cout << "top " << k << " of " << n << std::endl;
+    std::cout << "from_list + deleteMin: " << t_heap << " s" << std::endl;
+    std::cout << "deleteMin of shared:   " << t_shared / k << " s each" << std::endl;
+    std::cout << "std::sort:             " << t_sort << " s" << std::endl;
+    std::cout << "std::priority_queue:   " << t_std << " s" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,54 @@
+#include <cassert>
+#include <iostream>
+#include <string>
+
+#define PRELUDE_LIST_LATENCY
+#include "List.hpp"
+
+using namespace prelude;
+
+int main(int argc, char** argv)
+{
+    auto n = argc > 1 ? std::stoi(argv[1]) : 100000;
+    auto repeats = argc > 2 ? std::stoi(argv[2]) : 20;
+
+    // Inputs of every power-of-two length up to n, so each operation lands in many length buckets.
+    for (auto r = 0; r < repeats; ++r) {
+        auto xs = empty<int>();
+        for (auto i = 0; i < n; ++i) {
+            xs = i | xs;
+            if ( (i & (i + 1)) == 0 ) {
+                auto k = static_cast<unsigned>( i + 1 );
+                auto ys = map( [](int x){ return x * 2; }, xs );
+                auto zs = filter( [](int x){ return x % 3 == 0; }, ys );
+                auto ws = reverse( take( k / 2, xs ) + drop( k / 2, ys ) );
+                assert( length( ws ) == k );
+                assert( sum( ys ) == 2 * sum( xs ) );
+                (void) zs;
+            }
+        }
+    }
+
+    auto& h = latency_histograms::instance();
+    assert( h.count( list_op::length, 1 ) == static_cast<unsigned>( repeats ) );
+    assert( h.count( list_op::cons, 0 ) == static_cast<unsigned>( repeats ) );
+    assert( h.percentile( list_op::map, 1, 0.5 ) <= h.percentile( list_op::map, 1, 1.0 ) );
+
+    // Freeing a long list by assigning over its last claim is recorded as a destroy.
+    auto xs = empty<int>();
+    for (auto i = 0; i < n; ++i) { xs = i | xs; }
+    std::size_t k = 1;
+    while ( ( std::size_t( 1 ) << k ) <= static_cast<std::size_t>( n ) ) { ++k; }
+    auto before = h.count( list_op::destroy, k );
+    xs = empty<int>();
+    assert( null( xs ) && h.count( list_op::destroy, k ) == before + 1 );
+
+    latency_dump( std::cout );
+
+    latency_reset();
+    assert( h.count( list_op::cons, 0 ) == 0 );
+    assert( h.percentile( list_op::map, 1, 0.5 ) == 0 );
+
+    std::cout << "All tests passed." << std::endl;
+    return 0;
+}
@@ -3,6 +3,8 @@
 #include <functional>
 #include <iostream>
 #include <sstream>
+#include <string>
+#include <vector>
 
 #include "List.hpp"
 
@@ -43,12 +45,19 @@ int main()
     test( length<double>, xs1, 1 );
     test( length<double>, xs,  9 );
 
-    test( head<double>, xs1, 1.0 );
-    test( head<double>, xs,  2.0 );
-    test( last<double>, xs1, 1.0 );
-    test( last<double>, xs, 10.0 );
-    test( tail<double>, xs1, empty<double>() );
-    test( tail<double>, xs, { 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0 } );
+    auto borrowed_head = static_cast<double const& (*)( list_ref<double> )>( head<double> );
+    auto borrowed_last = static_cast<double const& (*)( list_ref<double> )>( last<double> );
+    test( borrowed_head, xs1, 1.0 );
+    test( borrowed_head, xs,  2.0 );
+    test( borrowed_last, xs1, 1.0 );
+    test( borrowed_last, xs, 10.0 );
+    // The elements of temporary lists are copied out, so these must not dangle
+    auto const& h = head( tail( xs ) );
+    auto const& l = last( map( []( double x ){ return x * 2; }, xs ) );
+    assert( h == 3.0 && l == 20.0 );
+    auto owning_tail = static_cast<list<double> (*)( list<double> const& )>( tail<double> );
+    test( owning_tail, xs1, empty<double>() );
+    test( owning_tail, xs, { 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0 } );
     test( init<double>, xs1, empty<double>() );
     test( init<double>, xs, { 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0 } );
 
@@ -91,6 +100,60 @@ int main()
     test( f1, xs, { 2.0, 4.0, 6.0, 8.0, 10.0 } );
     test( f2, xs, { 3.0, 5.0, 7.0, 9.0 } );
 
+    auto ps = [](double d){ return [d](double x){return std::fmod(x,d) == 0;}; };
+    auto pss = std::vector<decltype(ps(0))>{ ps(2), ps(3), ps(11) };
+    assert( multi_filter( pss, xs ) == (std::vector<list<double>>{ { 2.0, 4.0, 6.0, 8.0, 10.0 }, { 3.0, 6.0, 9.0 }, empty<double>() }) );
+    assert( multi_filter( pss, empty<double>() ) == (std::vector<list<double>>( 3, empty<double>() )) );
+    auto ms = [](double d){ return [d](double x){return x*d;}; };
+    auto mss = std::vector<decltype(ms(0))>{ ms(1), ms(2), ms(0.5) };
+    assert( multi_sum( mss, xs ) == (std::vector<double>{ 54.0, 108.0, 27.0 }) );
+    assert( multi_sum( mss, empty<double>() ) == (std::vector<double>{ 0.0, 0.0, 0.0 }) );
+
+    test( std::bind(foldl<std::minus<double>, double, double>, std::minus<double>(), 0.0, _1), xs, -54.0 );
+    test( std::bind(foldr<std::minus<double>, double, double>, std::minus<double>(), 0.0, _1), xs, 6.0 );
+    test( std::bind(foldl1<std::minus<double>, double>, std::minus<double>(), _1), xs, -50.0 );
+    test( std::bind(scanl<std::plus<double>, double, double>, std::plus<double>(), 0.0, _1), xs1, { 0.0, 1.0 } );
+    test( std::bind(scanl<std::plus<double>, double, double>, std::plus<double>(), 0.0, _1), empty<double>(), { 0.0 } );
+    test( product<double>, empty<double>(), 1.0 );
+    test( product<double>, xs, 3628800.0 );
+    test( maximum<double>, xs, 10.0 );
+    test( minimum<double>, xs, 2.0 );
+    assert( last( scanl( std::plus<double>(), 0.0, xs ) ) == sum( xs ) );
+    assert( foldMap( [](double x){ return std::to_string( int( x ) ); }, xs ) == "2345678910" );
+    assert( fold_parallel( std::plus<double>(), 0.0, xs, 4 ) == 54.0 );
+    assert( fold_parallel( std::plus<double>(), 0.0, empty<double>() ) == 0.0 );
+    assert( any( [](double x){ return x > 9; }, xs ) && !any( [](double x){ return x > 10; }, xs ) );
+    assert( all( [](double x){ return x > 1; }, xs ) && !all( [](double x){ return x > 2; }, xs ) );
+    assert( and_( list<bool>{ true, true } ) && !and_( list<bool>{ true, false } ) && and_( empty<bool>() ) );
+    assert( or_( list<bool>{ false, true } ) && !or_( list<bool>{ false } ) && !or_( empty<bool>() ) );
+
+    assert( zipWith( std::multiplies<double>(), xs, list<double>{ 1.0, 2.0 } ) == (list<double>{ 2.0, 6.0 }) );
+    assert( null( zipWith( std::plus<double>(), xs, empty<double>() ) ) );
+    auto zs = zip( xs, map( [](double x){ return int( x ) % 3; }, xs ) );
+    assert( length( zs ) == 9 && head( zs ) == std::make_pair( 2.0, 2 ) );
+    auto uzs = unzip( zs );
+    assert( uzs.first == xs && zip( uzs.first, uzs.second ) == zs );
+    assert( null( unzip( zip( empty<double>(), xs ) ).second ) );
+
+    list<int> ks { 3, 1, 3, 2, 1, 4 };
+    assert( elem( 4, ks ) && notElem( 5, ks ) && !elem( 1, empty<int>() ) );
+    list<std::pair<std::string,int>> as { { "a", 1 }, { "b", 2 }, { "b", 3 } };
+    assert( *lookup( std::string("b"), as ) == 2 && !lookup( std::string("c"), as ) );
+    auto parts = partition( [](int k){ return k > 2; }, ks );
+    assert( parts.first == (list<int>{ 3, 3, 4 }) && parts.second == (list<int>{ 1, 2, 1 }) );
+    assert( nub( ks ) == (list<int>{ 3, 1, 2, 4 }) && null( nub( empty<int>() ) ) );
+    assert( group( list<int>{ 1, 1, 2, 1 } ) == (list<list<int>>{ { 1, 1 }, { 2 }, { 1 } }) );
+    assert( groupBy( [](int a, int b){ return a <= b; }, ks ) == (list<list<int>>{ { 3 }, { 1, 3, 2, 1, 4 } }) );
+    auto gs = group_on( [](int k){ return k % 2; }, ks );
+    assert( gs == (list<std::pair<int, list<int>>>{ { 1, { 3, 1, 3, 1 } }, { 0, { 2, 4 } } }) );
+    assert( sortOn( [](int k){ return -k; }, ks ) == (list<int>{ 4, 3, 3, 2, 1, 1 }) );
+
+    list_ref<int> r = ks;
+    assert( head( r ) == 3 && head( tail( tail( r ) ) ) == 3 && last( r ) == 4 && length( tail( r ) ) == 5 );
+    assert( sum( tail( r ) ) == 11 && elem( 2, tail( r ) ) && !elem( 3, drop( 3, ks ) ) );
+    assert( init( tail( r ) ) == (list<int>{ 1, 3, 2, 1 }) && tail( r ).own() == tail( ks ) );
+    assert( null( tail( tail( tail( tail( tail( tail( r ) ) ) ) ) ) ) );
+
     auto g = [&oss](list<double> const& ys){ oss.str(""); oss << ys; return oss.str(); };
     test( g, empty<double>(), "[]" );
     test( g, xs1, "[1]" );
@@ -0,0 +1,53 @@
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <utility>
+
+#include "List.hpp"
+#include "Timing.hpp"
+
+using namespace prelude;
+
+/** The quadratic Haskell-report definition of nub, for comparison. */
+template <typename A>
+list<A> nub_quadratic( list<A> const& xs )
+{
+    auto ys = empty<A>();
+    for ( auto zs = xs; !null( zs ); zs = tail( zs ) ) {
+        if ( notElem( head( zs ), ys ) ) { ys = head( zs ) | ys; }
+    }
+    return reverse( ys );
+}
+
+int main(int argc, char** argv)
+{
+    auto n = argc > 1 ? std::stoi(argv[1]) : 1000000;
+
+    // Low cardinality (100 distinct keys) and high cardinality (about n / 2 distinct keys).
+    for (auto cardinality : { 100, n / 2 }) {
+        std::srand( 7 );
+        auto xs = empty<int>();
+        for (auto i = 0; i < n; ++i) { xs = std::rand() % cardinality | xs; }
+
+        size_t distinct = 0, groups = 0;
+        auto t_nub = seconds( [&]{ distinct = length( nub( xs ) ); } );
+        auto t_group = seconds( [&]{ groups = length( group_on( [](int x){ return x; }, xs ) ); } );
+        // Results are kept alive outside the timed calls, so neither timing includes freeing them.
+        auto ps = std::make_pair( empty<int>(), empty<int>() );
+        auto t_partition = seconds( [&]{ ps = partition( [](int x){ return x % 2 == 0; }, xs ); } );
+        auto es = empty<int>(), os = empty<int>();
+        auto t_filters = seconds( [&]{
+            es = filter( [](int x){ return x % 2 == 0; }, xs );
+            os = filter( [](int x){ return x % 2 != 0; }, xs );
+        } );
+        assert( ps.first == es && ps.second == os && length( es ) + length( os ) == size_t( n ) );
+        assert( distinct == groups );
+        if ( cardinality <= 1000 ) { assert( nub_quadratic( xs ) == nub( xs ) ); }
+
+        std::cout << n << " elements, " << distinct << " distinct: nub " << t_nub << "s, group_on " << t_group
+                  << "s, partition " << t_partition << "s (two filters " << t_filters << "s)" << std::endl;
+    }
+
+    return 0;
+}
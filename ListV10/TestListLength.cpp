@@ -0,0 +1,50 @@
+#define PRELUDE_LIST_MEMO_LENGTH
+
+#include <cassert>
+#include <stdexcept>
+#include <vector>
+
+#include "List.hpp"
+
+using namespace prelude;
+
+int main()
+{
+    list<int> xs { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+    list<int> ys = 0 | xs;
+
+    assert( length( empty<int>() ) == 0 );
+    assert( length( xs ) == 10 );
+    assert( length( ys ) == 11 );
+    assert( length( tail( ys ) ) == 10 );
+
+    auto evens = filter( [](int x){return x % 2 == 0;}, xs );
+    assert( length( evens ) == 5 );
+    assert( length( map( [](int x){return x * 0.5;}, xs ) ) == 10 );
+    assert( length( reverse( xs ) ) == 10 );
+    assert( length( take( 3, xs ) ) == 3 );
+    assert( length( take( 30, xs ) ) == 10 );
+    assert( length( drop( 3, xs ) ) == 7 );
+    assert( null( drop( 30, xs ) ) );
+    assert( length( xs + ys ) == 21 );
+    assert( length( list<int>{ 1, 2 } + xs ) == 12 );
+    assert( length( list<int>{ 1, 2 } + list<int>{ 3 } ) == 3 );
+    assert( length( init( xs ) ) == 9 );
+
+    auto by3 = [](int x){return x % 3 == 0;};
+    std::vector<decltype(by3)> ps { by3, by3 };
+    for (auto const& zs : multi_filter( ps, xs )) {
+        assert( length( zs ) == 3 );
+    }
+
+    assert( xs[0] == 1 && xs[9] == 10 );
+    bool thrown = false;
+    try { xs[10]; } catch ( std::domain_error const& ) { thrown = true; }
+    assert( thrown );
+
+    assert( !( xs == ys ) );
+    assert( xs == tail( ys ) );
+    assert( take( 30, xs ) == xs );
+
+    return 0;
+}
@@ -0,0 +1,32 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include "List.hpp"
+
+using namespace prelude;
+
+int main(int argc, char** argv)
+{
+    auto n = std::stoi(argv[1]);
+    auto m = std::stof(argv[2]) + 1.f;
+
+    list<int> xs { n };
+    for (auto i = (n-1); i >= 1; --i) {
+        xs = i | xs;
+    }
+
+    auto divide_by = [](float j){ return [j](int x)->float{return x/j;}; };
+    std::vector<decltype(divide_by(0.f))> fs;
+    for (auto j = 2.f; j <= m; ++j ) {
+        fs.push_back( divide_by(j) );
+    }
+
+    auto z = 0.f;
+    for (auto y : multi_sum( fs, xs )) {
+        z += y;
+    }
+
+    std::cout << std::setprecision(12) << z << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,31 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include "List.hpp"
+
+using namespace prelude;
+
+int main(int argc, char** argv)
+{
+    auto n = std::stoi(argv[1]);
+    auto m = std::stoi(argv[2]);
+
+    list<int> xs = cons( n, empty<int>() );
+    for (auto i = (n-1); i >= 1; --i) {
+        xs = i | xs;
+    }
+
+    // Only the lengths are printed, so each filter is counted through an indicator function:
+    // holding all m - 1 filtered lists at once would take about n ln m nodes.
+    auto divisible_by = [](int j){ return [j](int x){return x % j == 0 ? size_t(1) : size_t(0);}; };
+    std::vector<decltype(divisible_by(0))> ps;
+    for (auto j = 2; j <= m; ++j ) {
+        ps.push_back( divisible_by(j) );
+    }
+
+    for (auto count : multi_sum( ps, xs )) {
+        std::cout << count << std::endl;
+    }
+
+    return 0;
+}
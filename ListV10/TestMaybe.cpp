@@ -1,10 +1,54 @@
-#include "Maybe.hpp"
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "List.hpp"
+#include "Timing.hpp"
+
+using namespace prelude;
 
 int main(int argc, char** argv)
 {
     maybe<int> x = just(5);
     maybe<int> y = nothing();
+    assert( isJust( x ) && *x == 5 && isNothing( y ) );
+    assert( fromMaybe( 0, x ) == 5 && fromMaybe( 0, y ) == 0 );
+    auto s = just( std::string( "moved" ) );
+    auto t = std::move( *s );
+    assert( t == "moved" );
+
+    auto n = argc > 1 ? std::stoi(argv[1]) : 1000000;
+    auto permille_empty = argc > 2 ? std::stoi(argv[2]) : 100;
+
+    // Many short lists, some of them empty: the first element of each is summed three ways.
+    std::srand( 42 );
+    std::vector<list<long>> xss;
+    xss.reserve( n );
+    for (auto i = 0; i < n; ++i) {
+        xss.push_back( std::rand() % 1000 < permille_empty ? empty<long>() : list<long>{ i, i + 1 } );
+    }
+
+    long guarded = 0, caught = 0, optional = 0;
+    auto t_guard = seconds( [&]{
+        for (auto const& xs : xss) { if ( !null( xs ) ) { guarded += head( xs ); } }
+    } );
+    auto t_catch = seconds( [&]{
+        for (auto const& xs : xss) {
+            try { caught += head( xs ); } catch ( std::domain_error const& ) {}
+        }
+    } );
+    auto t_maybe = seconds( [&]{
+        for (auto const& xs : xss) { if ( auto h = headMay( xs ) ) { optional += *h; } }
+    } );
+    assert( guarded == caught && caught == optional );
+
+    std::cout << "lists: " << n << ", empty: " << permille_empty / 10.0 << "%" << std::endl;
+    std::cout << "null then head:  " << t_guard << " s" << std::endl;
+    std::cout << "head with catch: " << t_catch << " s" << std::endl;
+    std::cout << "headMay:         " << t_maybe << " s" << std::endl;
 
     return 0;
 }
-
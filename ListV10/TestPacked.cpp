@@ -0,0 +1,59 @@
+#include <cassert>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "Packed.hpp"
+#include "Timing.hpp"
+
+using namespace prelude;
+
+int main(int argc, char** argv)
+{
+    auto n = argc > 1 ? std::stoi(argv[1]) : 10000000;
+
+    // Mixed signs, wide jumps and block boundaries all round-trip.
+    auto xs = empty<std::int64_t>();
+    std::srand( 11 );
+    for (auto i = 0; i < 1000; ++i) {
+        xs = ( i % 97 == 0 ? std::int64_t( std::rand() ) << 20 : std::int64_t( std::rand() % 200 ) - 100 ) | xs;
+    }
+    auto ps = pack( xs );
+    assert( length( ps ) == 1000 && to_list( ps ) == xs && sum( ps ) == sum( xs ) );
+    for (unsigned k : { 0u, 1u, 127u, 128u, 129u, 500u, 999u, 1000u }) {
+        assert( to_list( drop( k, ps ) ) == drop( k, xs ) );
+        assert( sum( drop( k, ps ) ) == sum( drop( k, xs ) ) );
+        if ( k < 1000 ) { assert( head( drop( k, ps ) ) == head( drop( k, xs ) ) ); }
+    }
+    auto qs = std::int64_t( 7 ) | ( std::int64_t( 8 ) | tail( ps ) );
+    assert( to_list( qs ) == ( std::int64_t( 7 ) | ( std::int64_t( 8 ) | tail( xs ) ) ) );
+    assert( sum( qs ) == sum( xs ) - head( xs ) + 15 && head( tail( qs ) ) == 8 && length( drop( 2, qs ) ) == 999 );
+    assert( to_list( map( [](std::int64_t x){ return x * 3; }, ps ) ) == map( [](std::int64_t x){ return x * 3; }, xs ) );
+    assert( map( [](std::int64_t x){ return std::to_string( x ); }, ps ) == map( [](std::int64_t x){ return std::to_string( x ); }, xs ) );
+    assert( map( [](std::int64_t x){ return x > 0; }, ps ) == map( [](std::int64_t x){ return x > 0; }, xs ) );
+    assert( null( pack( empty<int>() ) ) && null( drop( 5, pack( list<int>{ 1, 2 } ) ) ) );
+
+    // Ids: increasing with small random gaps, and timestamps: near-monotone with occasional jitter.
+    // 64-bit, as ids and timestamps usually are; stamps are microseconds since the epoch.
+    auto ids = empty<std::int64_t>(), stamps = empty<std::int64_t>();
+    auto id = std::int64_t( n ) * 3;
+    auto stamp = std::int64_t( 1700000000 ) * 1000000;
+    for (auto i = 0; i < n; ++i) {
+        ids = ( id -= 1 + std::rand() % 3 ) | ids;
+        stamps = ( stamp -= std::rand() % 1000 - 50 ) | stamps;
+    }
+    for (auto const& xs : { ids, stamps }) {
+        auto ps = pack( empty<std::int64_t>() );
+        auto t_pack = seconds( [&]{ ps = pack( xs ); } );
+        // Summed modulo 2^64: ten million timestamps overflow a signed total.
+        std::uint64_t s1 = 0, s2 = 0;
+        auto t_list = seconds( [&]{ s1 = foldl( [](std::uint64_t a, std::int64_t x){ return a + std::uint64_t( x ); }, std::uint64_t( 0 ), xs ); } );
+        auto t_packed = seconds( [&]{ s2 = foldl( [](std::uint64_t a, std::int64_t x){ return a + std::uint64_t( x ); }, std::uint64_t( 0 ), ps ); } );
+        assert( s1 == s2 && to_list( ps ) == xs );
+        std::cout << "bits/element: " << bits_per_element( ps ) << " (list node: " << 8 * sizeof( _list_node<std::int64_t> ) << ")"
+                  << ", pack " << t_pack << " s, fold list " << t_list << " s, fold packed " << t_packed << " s" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,130 @@
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Queue.hpp"
+#include "Timing.hpp"
+
+using namespace prelude;
+
+template <typename A>
+list<A> from_std( std::deque<A> const& d )
+{
+    auto xs = empty<A>();
+    for (auto x = d.rbegin(); x != d.rend(); ++x) { xs = *x | xs; }
+    return xs;
+}
+
+int main(int argc, char** argv)
+{
+    auto n = argc > 1 ? std::stoi(argv[1]) : 1000000;
+
+    // Random operations agree with std::deque, and every saved version is unaffected by later ones.
+    std::srand( 17 );
+    std::vector<std::pair<queue<int>, std::deque<int>>> qs{ { queue<int>(), std::deque<int>() } };
+    std::vector<std::pair<deque<int>, std::deque<int>>> ds{ { deque<int>(), std::deque<int>() } };
+    for (auto i = 0; i < 3000; ++i) {
+        auto q = qs[std::rand() % qs.size()];
+        if ( std::rand() % 3 && !null( q.first ) ) { q.first = pop_front( q.first ); q.second.pop_front(); }
+        else { q.first = push_back( q.first, i ); q.second.push_back( i ); }
+        assert( length( q.first ) == q.second.size() );
+        if ( !q.second.empty() ) { assert( front( q.first ) == q.second.front() && back( q.first ) == q.second.back() ); }
+        qs.push_back( q );
+
+        auto d = ds[std::rand() % ds.size()];
+        switch ( std::rand() % 4 ) {
+        case 0: d.first = push_front( d.first, i ); d.second.push_front( i ); break;
+        case 1: d.first = push_back( d.first, i ); d.second.push_back( i ); break;
+        case 2: if ( !null( d.first ) ) { d.first = pop_front( d.first ); d.second.pop_front(); } break;
+        default: if ( !null( d.first ) ) { d.first = pop_back( d.first ); d.second.pop_back(); } break;
+        }
+        assert( length( d.first ) == d.second.size() );
+        if ( !d.second.empty() ) { assert( front( d.first ) == d.second.front() && back( d.first ) == d.second.back() ); }
+        ds.push_back( d );
+    }
+    for (auto const& q : qs) { assert( to_list( q.first ) == from_std( q.second ) ); }
+    for (auto const& d : ds) { assert( to_list( d.first ) == from_std( d.second ) ); }
+    try { front( queue<int>() ); assert( false ); } catch ( std::domain_error const& ) {}
+    try { pop_back( deque<int>() ); assert( false ); } catch ( std::domain_error const& ) {}
+
+    // Temporaries give values: nothing may point into lists freed at the end of the statement.
+    std::string s( 40, 's' );
+    auto const& qf = front( push_back( queue<std::string>(), s ) );
+    auto const& db = back( push_front( deque<std::string>(), s ) );
+    assert( qf == s && db == s );
+
+    // Long runs at one end, popped from the other, through every re-split and on old versions.
+    auto d = deque<int>();
+    std::deque<int> e;
+    for (auto i = 0; i < 5000; ++i) { d = i % 7 ? push_back( d, i ) : push_front( d, i ); i % 7 ? e.push_back( i ) : e.push_front( i ); }
+    auto saved = d;
+    for (auto r = 0; r < 2; ++r) {
+        auto c = saved;
+        auto f = e;
+        while ( !f.empty() ) {
+            assert( length( c ) == f.size() && front( c ) == f.front() && back( c ) == f.back() );
+            if ( f.size() % 3 ) { c = pop_front( c ); f.pop_front(); } else { c = pop_back( c ); f.pop_back(); }
+        }
+        assert( null( c ) );
+    }
+
+    // FIFO throughput: n pushes interleaved with pops, keeping about a thousand queued.
+    long s1 = 0, s2 = 0, s3 = 0, s4 = 0;
+    auto t_queue = seconds( [&]{
+        auto q = queue<int>();
+        for (auto i = 0; i < n; ++i) { q = push_back( q, i ); if ( i >= 1000 ) { s1 += front( q ); q = pop_front( q ); } }
+    } );
+    auto t_std = seconds( [&]{
+        std::deque<int> q;
+        for (auto i = 0; i < n; ++i) { q.push_back( i ); if ( i >= 1000 ) { s2 += q.front(); q.pop_front(); } }
+    } );
+    // The same, keeping the previous version alive at every step, as a persistent structure allows.
+    auto t_cow = seconds( [&]{
+        auto q = std::make_shared<std::deque<int> const>();
+        for (auto i = 0; i < n / 100; ++i) {
+            auto before = q;
+            auto p = std::make_shared<std::deque<int>>( *q );
+            p->push_back( i );
+            if ( i >= 1000 ) { s3 += p->front(); p->pop_front(); }
+            q = std::move( p );
+        }
+    } );
+    auto t_plus = seconds( [&]{
+        auto q = empty<int>();
+        for (auto i = 0; i < n / 100; ++i) { q = q + list<int>{ i }; if ( i >= 1000 ) { s4 += head( q ); q = tail( q ); } }
+    } );
+    // Worst single deque operation: n pushes at the back, then n pops at the front, each timed.
+    double t_worst = 0;
+    long s5 = 0;
+    auto t_deque = seconds( [&]{
+        auto d = deque<int>();
+        for (auto i = 0; i < n; ++i) { t_worst = std::max( t_worst, seconds( [&]{ d = push_back( d, i ); } ) ); }
+        for (auto i = 0; i < n; ++i) { s5 += front( d ); t_worst = std::max( t_worst, seconds( [&]{ d = pop_front( d ); } ) ); }
+    } );
+    // Worst single queue operation: n pushes, n / 2 pops, then n / 2 more pushes, each timed. The
+    // pushes after the pops follow finished rotations, which left old rears behind to be freed.
+    double q_worst = 0;
+    long s6 = 0;
+    {
+        auto q = queue<int>();
+        for (auto i = 0; i < n; ++i) { q_worst = std::max( q_worst, seconds( [&]{ q = push_back( q, i ); } ) ); }
+        for (auto i = 0; i < n / 2; ++i) { s6 += front( q ); q_worst = std::max( q_worst, seconds( [&]{ q = pop_front( q ); } ) ); }
+        for (auto i = 0; i < n / 2; ++i) { q_worst = std::max( q_worst, seconds( [&]{ q = push_back( q, i ); } ) ); }
+        assert( length( q ) == size_t( n - n / 2 + n / 2 ) && back( q ) == n / 2 - 1 );
+    }
+    assert( s1 == s2 && s3 == s4 && s5 == long( n ) * ( n - 1 ) / 2 && s6 == long( n / 2 ) * ( n / 2 - 1 ) / 2 );
+
+    std::cout << "operations: " << n << std::endl;
+    std::cout << "prelude::queue:           " << t_queue << " s (worst single operation " << q_worst * 1e6 << " us)" << std::endl;
+    std::cout << "std::deque (ephemeral):   " << t_std << " s" << std::endl;
+    std::cout << "prelude::deque:           " << t_deque << " s (" << 2 * n << " operations, worst " << t_worst * 1e6 << " us)" << std::endl;
+    std::cout << "std::deque copy-on-write: " << t_cow * 100 << " s (extrapolated from " << n / 100 << ")" << std::endl;
+    std::cout << "xs + list{x}:             " << t_plus * 100 << " s (extrapolated from " << n / 100 << ")" << std::endl;
+
+    return 0;
+}
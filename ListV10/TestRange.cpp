@@ -0,0 +1,66 @@
+#include <cassert>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "Range.hpp"
+#include "Timing.hpp"
+
+using namespace prelude;
+
+int main(int argc, char** argv)
+{
+    auto n = argc > 1 ? std::stoi(argv[1]) : 10000000;
+    auto m = argc > 2 ? std::stoi(argv[2]) : 10;
+
+    auto rs = enumFromTo( 1, 10 );
+    assert( length( rs ) == 10 && head( rs ) == 1 && last( rs ) == 10 && rs[4] == 5 );
+    assert( to_list( rs ) == (list<int>{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 }) );
+    assert( sum( rs ) == 55 && sum( enumFromTo( 5, 4 ) ) == 0 && null( enumFromTo( 5, 4 ) ) );
+    assert( to_list( tail( rs ) ) == tail( to_list( rs ) ) );
+    assert( to_list( take( 3, drop( 2, rs ) ) ) == (list<int>{ 3, 4, 5 }) && null( drop( 20, rs ) ) );
+    assert( to_list( reverse( rs ) ) == reverse( to_list( rs ) ) );
+    assert( to_list( enumFromThenTo( 1, 3, 10 ) ) == (list<int>{ 1, 3, 5, 7, 9 }) );
+    assert( to_list( enumFromThenTo( 5, 3, -2 ) ) == (list<int>{ 5, 3, 1, -1 }) );
+    assert( elem( 7, enumFromThenTo( 1, 3, 10 ) ) && !elem( 8, enumFromThenTo( 1, 3, 10 ) ) && !elem( 11, rs ) );
+
+    auto cs = map( affine<int>{ 0, 5 }, enumFromTo( 1, 10 ) );
+    assert( elem( 5, cs ) && !elem( 4, cs ) && length( cs ) == 10 && !elem( 5, map( affine<int>{ 0, 5 }, enumFromTo( 1, 0 ) ) ) );
+    auto ys = map( affine<int>{ 3, -1 }, rs );
+    assert( to_list( ys ) == map( [](int x){ return 3 * x - 1; }, to_list( rs ) ) );
+    assert( map( [](int x){ return x * x; }, rs ) == (list<int>{ 1, 4, 9, 16, 25, 36, 49, 64, 81, 100 }) );
+
+    // Congruence filters stay symbolic and agree with the element-wise definition.
+    for (auto step : { 1, 2, 3, -4, 6 }) {
+        for (auto j = 1; j <= 12; ++j) {
+            for (auto r = 0; r < j; ++r) {
+                auto xs = enumFromThenTo( -17, -17 + step, step > 0 ? 60 : -90 );
+                auto p = modulo<int>{ j, r };
+                assert( to_list( filter( p, xs ) ) == filter( p, to_list( xs ) ) );
+                assert( to_list( filter( p, xs ) ) == filter( [p](int x){ return p( x ); }, xs ) );
+            }
+        }
+    }
+    assert( filter( [](int x){ return x % 4 == 1; }, rs ) == (list<int>{ 1, 5, 9 }) );
+
+    std::ostringstream oss;
+    oss << enumFromThenTo( 10, 7, 0 );
+    assert( oss.str() == "[10,7,4,1]" );
+
+    // TestListFilter's workload: every multiple of j in 1..n, for j = 2..m.
+    size_t counted = 0, symbolic = 0;
+    auto t_list = seconds( [&]{
+        auto xs = to_list( enumFromTo( 1, n ) );
+        for (auto j = 2; j <= m; ++j) { counted += length( filter( [j](int x){ return x % j == 0; }, xs ) ); }
+    } );
+    auto t_range = seconds( [&]{
+        auto xs = enumFromTo( 1, n );
+        for (auto j = 2; j <= m; ++j) { symbolic += length( filter( divisible_by( j ), xs ) ); }
+    } );
+    assert( counted == symbolic );
+    std::cout << "n = " << n << ", multiples counted: " << counted << std::endl;
+    std::cout << "list:  " << t_list << " s" << std::endl;
+    std::cout << "range: " << t_range << " s" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,70 @@
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "Rope.hpp"
+#include "Timing.hpp"
+
+using namespace prelude;
+
+int main(int argc, char** argv)
+{
+    auto n = argc > 1 ? std::stoi(argv[1]) : 8000000;
+
+    auto hello = rope( "Hello World!" );
+    assert( to_string( take( 5, hello ) ) == "Hello" && to_string( drop( 6, hello ) ) == "World!" );
+    assert( head( hello ) == 'H' && last( hello ) == '!' && hello[4] == 'o' && length( init( tail( hello ) ) ) == 10 );
+    assert( to_list( hello ) == to_list( rope( to_string( hello ) ) ) && to_rope( to_list( hello ) ) == hello );
+    assert( isJust( flat( hello ) ) && *flat( hello ) == "Hello World!" && null( rope() ) && null( drop( 20, hello ) ) );
+
+    // Random edits of a rope and a string agree, across many chunk boundaries.
+    std::srand( 3 );
+    std::string s;
+    for (auto i = 0; i < 20000; ++i) { s += char( 'a' + std::rand() % 26 ); }
+    auto r = rope( s );
+    for (auto i = 0; i < 500; ++i) {
+        auto k = std::rand() % ( s.size() + 1 );
+        switch ( std::rand() % 4 ) {
+        case 0: { auto p = splitAt( k, r ); r = p.second + p.first; s = s.substr( k ) + s.substr( 0, k ); break; }
+        case 1: { r = take( k, r ) + rope( "-\n-" ) + drop( k, r ); s.insert( k, "-\n-" ); break; }
+        case 2: { r = 'x' | r; s.insert( 0, 1, 'x' ); break; }
+        default: { auto m = std::rand() % 100; r = take( k, r ) + drop( k + m, r ); s.erase( k, m ); break; }
+        }
+        assert( length( r ) == s.size() );
+    }
+    assert( to_string( r ) == s && r == rope( s ) && !isJust( flat( r ) ) );
+    for (auto i = 0; i < 100; ++i) { auto k = std::rand() % s.size(); assert( r[k] == s[k] ); }
+    assert( isPrefixOf( take( 9999, r ), r ) && !isPrefixOf( 'y' | r, r ) && isPrefixOf( rope(), r ) );
+    assert( elem( 'x', r ) == ( s.find( 'x' ) != std::string::npos ) && !elem( '#', r ) );
+    assert( length( lines( r ) ) == size_t( std::count( s.begin(), s.end(), '\n' ) + 1 ) );
+    assert( to_string( foldl( []( rope a, rope l ){ return a + l + rope( "\n" ); }, rope(), lines( r ) ) ) == s + "\n" );
+    assert( to_string( map( []( char c ){ return c == '-' ? '+' : c; }, r ) ).find( '-' ) == std::string::npos );
+    assert( length( filter( []( char c ){ return c != '\n'; }, r ) ) == length( r ) - length( lines( r ) ) + 1 );
+    auto ws = words( rope( "  the quick\tbrown\n\nfox " ) );
+    assert( length( ws ) == 4 && to_string( ws[2] ) == "brown" && to_string( last( ws ) ) == "fox" );
+    assert( length( lines( rope( "a\n\nb\n" ) ) ) == 3 && null( lines( rope() ) ) );
+
+    // Multi-megabyte text: line and word splitting, search and flattening.
+    std::string text;
+    while ( text.size() < size_t( n ) ) { text += "lorem ipsum dolor sit amet, consectetur\nadipiscing elit "; }
+    auto big = rope( text );
+    auto chars = to_list( big );
+    size_t nl = 0, nw = 0;
+    auto t_lines = seconds( [&]{ nl = length( lines( big ) ); nw = length( words( big ) ); } );
+    bool found = false;
+    auto t_elem = seconds( [&]{ found = elem( '#', big ); } );
+    auto t_list = seconds( [&]{ found = found || elem( '#', chars ); } );
+    // Both copies below write to memory already faulted in by this one.
+    auto out = to_string( big );
+    auto t_flat = seconds( [&]{ out = to_string( big ); } );
+    auto t_copy = seconds( [&]{ out = std::string( text ); } );
+    assert( !found && out == to_string( big ) && nl > 0 && nw > 0 );
+
+    std::cout << "bytes: " << length( big ) << ", chunks: " << length( chunks( big ) ) << std::endl;
+    std::cout << "lines + words: " << t_lines << " s" << std::endl;
+    std::cout << "elem rope: " << t_elem << " s, elem list<char>: " << t_list << " s" << std::endl;
+    std::cout << "to_string: " << t_flat << " s, std::string copy: " << t_copy << " s" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,69 @@
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "Runs.hpp"
+#include "Timing.hpp"
+
+using namespace prelude;
+
+int main(int argc, char** argv)
+{
+    auto n = argc > 1 ? std::stoi(argv[1]) : 10000000;
+    auto stretch = argc > 2 ? std::stoi(argv[2]) : 1000;
+
+    list<int> xs { 1, 1, 1, 2, 2, 3, 1, 1 };
+    auto rs = encode( xs );
+    assert( length( rs ) == 8 && run_count( rs ) == 4 && to_list( rs ) == xs );
+    assert( head( rs ) == 1 && rs[3] == 2 && rs[5] == 3 && rs[7] == 1 && sum( rs ) == 12 );
+    assert( to_list( tail( rs ) ) == tail( xs ) && run_count( tail( rs ) ) == 4 );
+    for (unsigned k = 0; k <= 9; ++k) {
+        assert( to_list( drop( k, rs ) ) == drop( k, xs ) );
+        assert( to_list( take( k, rs ) ) == take( k, xs ) );
+        assert( to_list( take( 3, drop( k, rs ) ) ) == take( 3, drop( k, xs ) ) );
+        assert( sum( drop( k, rs ) ) == sum( drop( k, xs ) ) );
+    }
+
+    auto ys = 1 | ( 1 | tail( rs ) );
+    assert( run_count( ys ) == 4 && to_list( ys ) == ( 1 | ( 1 | tail( xs ) ) ) );
+    auto zs = 5 | drop( 1, rs );
+    assert( run_count( zs ) == 5 && to_list( zs ) == ( 5 | drop( 1, xs ) ) );
+    assert( drop( 1, rs ) == encode( drop( 1, xs ) ) && !( rs == ys ) );
+    assert( map( [](int x){ return x % 2; }, rs ) == encode( map( [](int x){ return x % 2; }, xs ) ) );
+    assert( run_count( map( [](int x){ return x < 3; }, rs ) ) == 3 );
+    assert( null( drop( 8, rs ) ) && null( take( 0, rs ) ) && length( replicate( 5, 'x' ) ) == 5 );
+
+    // Temporaries give values: nothing may point into runs freed at the end of the statement.
+    std::string s( 40, 's' );
+    auto ss = encode( list<std::string>{ "a", "a", "b" } );
+    auto const& h = head( s | ss );
+    auto const& e = ( s | ss )[3];
+    assert( h == s && e == "b" );
+
+    std::ostringstream oss;
+    oss << replicate( 3, 7 );
+    assert( oss.str() == "[7,7,7]" );
+
+    // Telemetry with long constant stretches: n samples, changing value about every `stretch` samples.
+    std::srand( 3 );
+    auto samples = empty<int>();
+    auto value = 0;
+    for (auto i = 0; i < n; ++i) {
+        if ( std::rand() % stretch == 0 ) { value = std::rand() % 100; }
+        samples = value | samples;
+    }
+    auto t_encode = seconds( [&]{ rs = encode( samples ); } );
+    long s1 = 0, s2 = 0;
+    auto t_list = seconds( [&]{ s1 = foldl( [](long a, int x){ return a + x; }, 0L, samples ); } );
+    auto t_runs = seconds( [&]{ s2 = sum( map( [](int x){ return long( x ); }, rs ) ); } );
+    assert( s1 == s2 && length( rs ) == length( samples ) );
+
+    std::cout << "elements: " << length( rs ) << ", runs: " << run_count( rs ) << std::endl;
+    std::cout << "encode:   " << t_encode << " s" << std::endl;
+    std::cout << "sum list: " << t_list << " s" << std::endl;
+    std::cout << "sum runs: " << t_runs << " s" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,49 @@
+#include <cassert>
+#include <sstream>
+
+#include "StaticList.hpp"
+
+using namespace prelude;
+
+constexpr static_list xs1 { 1.0 };
+constexpr static_list xs  { 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0 };
+constexpr static_list<double,9> none {};
+
+static_assert( null( none ) );
+static_assert( !null( xs1 ) );
+static_assert( length( xs ) == 9 );
+
+static_assert( head( xs1 ) == 1.0 );
+static_assert( head( xs ) == 2.0 );
+static_assert( xs[8] == 10.0 );
+static_assert( tail( xs1 ) == none );
+static_assert( tail( xs ) == static_list{ 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0 } );
+static_assert( cons( 1.0, xs ) == static_list{ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0 } );
+
+static_assert( take( 3, xs ) == static_list{ 2.0, 3.0, 4.0 } );
+static_assert( take( 3, xs1 ) == xs1 );
+static_assert( drop( 3, xs ) == static_list{ 5.0, 6.0, 7.0, 8.0, 9.0, 10.0 } );
+static_assert( drop( 3, xs1 ) == none );
+
+static_assert( xs1 + xs == cons( 1.0, xs ) );
+static_assert( reverse( xs ) == static_list{ 10.0, 9.0, 8.0, 7.0, 6.0, 5.0, 4.0, 3.0, 2.0 } );
+
+static_assert( sum( none ) == 0.0 );
+static_assert( sum( xs ) == 54.0 );
+
+static_assert( map( [](double x){ return int( x ) * 2; }, xs1 ) == static_list{ 2 } );
+static_assert( filter( [](double x){ return int( x ) % 2 == 0; }, xs ) == static_list{ 2.0, 4.0, 6.0, 8.0, 10.0 } );
+static_assert( sum( map( [](double x){ return x * x; }, filter( [](double x){ return x < 5; }, xs ) ) ) == 29.0 );
+
+int main()
+{
+    std::ostringstream oss;
+    oss << xs;
+    assert( oss.str() == "[2,3,4,5,6,7,8,9,10]" );
+
+    auto ys = to_list( xs );
+    assert( length( ys ) == 9 && sum( ys ) == 54.0 );
+    assert( ys == (list<double>{ 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0 }) );
+
+    return 0;
+}
@@ -0,0 +1,85 @@
+#include <cassert>
+#include <cstdlib>
+#include <sstream>
+#include <vector>
+
+#include "Vector.hpp"
+
+using namespace prelude;
+
+/** Checks a persistent vector element-by-element against a reference std::vector. */
+template <typename A>
+void check( rrb_vector<A> const& xs, std::vector<A> const& ref )
+{
+    assert( length( xs ) == ref.size() );
+    for (std::size_t i = 0; i < ref.size(); ++i) { assert( xs[i] == ref[i] ); }
+}
+
+int main()
+{
+    rrb_vector<double> none;
+    rrb_vector<double> xs { 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0 };
+
+    assert( null( none ) && !null( xs ) );
+    assert( head( xs ) == 2.0 );
+    assert( tail( xs ) == (rrb_vector<double>{ 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0 }) );
+    assert( take( 3, xs ) == (rrb_vector<double>{ 2.0, 3.0, 4.0 }) );
+    assert( drop( 6, xs ) == (rrb_vector<double>{ 8.0, 9.0, 10.0 }) );
+    assert( null( drop( 20, xs ) ) && take( 20, xs ) == xs );
+    assert( reverse( xs ) == (rrb_vector<double>{ 10.0, 9.0, 8.0, 7.0, 6.0, 5.0, 4.0, 3.0, 2.0 }) );
+    assert( sum( xs ) == 54.0 && sum( none ) == 0.0 );
+    assert( filter( [](double x){ return int( x ) % 2 == 0; }, xs ) == (rrb_vector<double>{ 2.0, 4.0, 6.0, 8.0, 10.0 }) );
+    assert( map( [](double x){ return int( x ) * 2; }, take( 2, xs ) ) == (rrb_vector<int>{ 4, 6 }) );
+    assert( none + xs == xs && xs + none == xs );
+    assert( xs.update( 0, 1.0 ) == (rrb_vector<double>{ 1.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0 }) );
+    assert( head( xs ) == 2.0 );
+
+    std::ostringstream oss;
+    oss << xs << none;
+    assert( oss.str() == "[2,3,4,5,6,7,8,9,10][]" );
+
+    // Build, slice, update and concatenate large vectors at awkward sizes.
+    std::srand( 42 );
+    rrb_vector<int> ys;
+    std::vector<int> ref;
+    for (auto i = 0; i < 100000; ++i) { ys = ys.push_back( i ); ref.push_back( i ); }
+    check( ys, ref );
+    assert( sum( map( [](int x){ return long( x ); }, ys ) ) == 100000L * 99999 / 2 );
+
+    for (auto round = 0; round < 200; ++round) {
+        auto k = std::size_t( std::rand() ) % ( ref.size() + 1 );
+        auto l = std::size_t( std::rand() ) % ( ref.size() + 1 );
+        auto left = take( k, ys );
+        auto right = drop( l, ys );
+        std::vector<int> expect( ref.begin(), ref.begin() + k );
+        expect.insert( expect.end(), ref.begin() + l, ref.end() );
+        auto zs = left + right;
+        if ( !expect.empty() ) {
+            auto i = std::size_t( std::rand() ) % expect.size();
+            zs = zs.update( i, -1 );
+            expect[i] = -1;
+        }
+        zs = zs.push_back( round );
+        expect.push_back( round );
+        if ( expect.size() > 300000 ) { expect.resize( 1000 ); zs = take( 1000, zs ); }
+        check( zs, expect );
+        ys = zs;
+        ref = expect;
+    }
+
+    // Repeated concatenation must stay shallow.
+    rrb_vector<int> cs;
+    std::vector<int> cref;
+    for (auto i = 0; i < 2000; ++i) {
+        auto piece = take( std::size_t( std::rand() ) % 50, drop( std::size_t( std::rand() ) % 100, ys ) );
+        cs = cs + piece;
+        for (std::size_t j = 0; j < length( piece ); ++j) { cref.push_back( piece[j] ); }
+    }
+    check( cs, cref );
+    // Within one level of a dense tree of the same length, however many seams it has.
+    std::size_t dense = 0;
+    for (auto capacity = rrb_vector<int>::WIDTH; capacity < length( cs ); capacity *= rrb_vector<int>::WIDTH) { ++dense; }
+    assert( height( cs ) <= dense + 1 );
+
+    return 0;
+}
@@ -0,0 +1,21 @@
+#ifndef HPP_PRELUDE_TIMING
+#define HPP_PRELUDE_TIMING
+
+#include <chrono>
+
+/**
+ * Times one call of a function on the steady clock, for the benchmarking test drivers.
+ * Kept outside namespace prelude, which holds only the library itself.
+ * @param f a function taking no arguments
+ * @return the wall-clock time taken by {@code f()}, in seconds
+ */
+template <typename F>
+double seconds( F f )
+{
+    auto start = std::chrono::steady_clock::now();
+    f();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+#endif //HPP_PRELUDE_TIMING
@@ -0,0 +1,717 @@
+#ifndef HPP_PRELUDE_VECTOR
+#define HPP_PRELUDE_VECTOR
+
+#include <algorithm>
+#include <cstddef>
+#include <ostream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/**
+ * Implementation of Haskell-like, functional programming idioms, particularly recursive lists.
+ */
+namespace prelude {
+
+/**
+ * Family of immutable, indexable sequence types implemented as relaxed radix balanced
+ * (RRB) trees with 32-way branching. Elements live in leaves of up to 32 elements; the
+ * rightmost leaf is kept apart as a tail so that {@code push_back} usually copies only
+ * that leaf. Internal nodes carry cumulative size tables, so trees produced by
+ * concatenation and slicing need not be perfectly dense; a radix guess still finds the
+ * right child in one or two steps. Index, update, push_back, take, drop and {@code +}
+ * are O(log32 n), and every operation shares all untouched nodes with its arguments.
+ * The free functions below mirror those for {@code list<A>}, so code can switch between
+ * the two by changing a typedef.
+ *
+ * @author Matthew A Johnson
+ * @version 1.0
+ */
+template <typename A>
+class rrb_vector
+{
+    struct node;
+public:
+    /** Branching factor, and the capacity of a leaf. */
+    static constexpr std::size_t WIDTH = 32;
+
+    /**
+     * Constructs an empty vector.
+     */
+    rrb_vector() : _root( nullptr ), _height( 0 ), _tail( nullptr ), _size( 0 ) {}
+    /**
+     * Constructs a vector using standard uniform initialization.
+     * @param xs a comma-separated list of values that will be elements of this vector
+     */
+    rrb_vector( std::initializer_list<A> xs ) : rrb_vector()
+        { for ( auto const& x : xs ) { *this = push_back( x ); } }
+    /**
+     * Makes a shallow copy of the specified vector, sharing all of its nodes.
+     * @param xs the existing vector to be copied
+     */
+    rrb_vector( rrb_vector const& xs )
+        : _root( acquire( xs._root ) ), _height( xs._height ), _tail( acquire( xs._tail ) ), _size( xs._size ) {}
+    /**
+     * Move-constructor for vectors.
+     * @param xs the r-value vector to be moved
+     */
+    rrb_vector( rrb_vector && xs ) noexcept
+        : _root( xs._root ), _height( xs._height ), _tail( xs._tail ), _size( xs._size )
+        { xs._root = xs._tail = nullptr; xs._height = xs._size = 0; }
+    /**
+     * Destroys this vector and any referenced nodes for which this vector was sole owner.
+     */
+    ~rrb_vector() { release( _root ); release( _tail ); }
+    /**
+     * Copy-assignment of vectors (shallow).
+     * @param xs the existing vector to be copied
+     */
+    rrb_vector& operator= ( rrb_vector const& xs )
+        { rrb_vector ys( xs ); swap( ys ); return *this; }
+    /**
+     * Move-assignment of vectors.
+     * @param xs the r-value vector to be moved
+     */
+    rrb_vector& operator= ( rrb_vector && xs ) noexcept
+        { rrb_vector ys( std::move( xs ) ); swap( ys ); return *this; }
+
+    /**
+     * Casting operator permits type-conversion from vector to boolean for use in test expressions.
+     */
+    explicit operator bool() const { return _size != 0; }
+
+    /**
+     * Gets the element at the specified position of this vector in O(log32 n).
+     * @param i a zero-based index
+     * @return the element at position {@code i}
+     * @throws std::domain_error if {@code i} is not less than the length of this vector
+     */
+    A const& operator[] ( std::size_t i ) const
+    {
+        if ( i >= _size ) { throw std::domain_error("prelude::[]: index too large"); }
+        auto tree = _size - tail_size();
+        if ( i >= tree ) { return _tail->_elems[i - tree]; }
+        auto n = _root;
+        for ( auto h = _height; h > 0; --h ) {
+            auto j = locate( n, h, i );
+            if ( j > 0 ) { i -= n->_sizes[j - 1]; }
+            n = n->_kids[j];
+        }
+        return n->_elems[i];
+    }
+
+    /**
+     * Gets a vector that differs from this one only at the specified position, in O(log32 n).
+     * @param i a zero-based index
+     * @param x the new element
+     * @return a vector with {@code x} at position {@code i}
+     * @throws std::domain_error if {@code i} is not less than the length of this vector
+     */
+    rrb_vector update( std::size_t i, A x ) const
+    {
+        if ( i >= _size ) { throw std::domain_error("prelude::update: index too large"); }
+        rrb_vector ys( *this );
+        auto tree = _size - tail_size();
+        if ( i >= tree ) {
+            auto t = new node( *_tail );
+            t->_elems[i - tree] = std::move( x );
+            release( ys._tail );
+            ys._tail = acquire( t );
+        } else {
+            auto r = acquire( assoc( _root, _height, i, std::move( x ) ) );
+            release( ys._root );
+            ys._root = r;
+        }
+        return ys;
+    }
+
+    /**
+     * Gets a vector with an element appended, in amortised O(1) (O(log32 n) every 32 elements).
+     * @param x an element
+     * @return a vector with the elements of this one followed by {@code x}
+     */
+    rrb_vector push_back( A x ) const
+    {
+        rrb_vector ys( *this );
+        if ( _tail && _tail->_elems.size() < WIDTH ) {
+            auto t = new node( *_tail );
+            t->_elems.push_back( std::move( x ) );
+            release( ys._tail );
+            ys._tail = acquire( t );
+        } else {
+            if ( _tail ) { ys.push_tail(); }
+            auto t = new node();
+            t->_elems.push_back( std::move( x ) );
+            ys._tail = acquire( t );
+        }
+        ++ys._size;
+        return ys;
+    }
+
+    /** Exchanges the contents of two vectors. */
+    void swap( rrb_vector& xs ) noexcept
+    {
+        std::swap( _root, xs._root );
+        std::swap( _height, xs._height );
+        std::swap( _tail, xs._tail );
+        std::swap( _size, xs._size );
+    }
+
+private:
+    /**
+     * Internal reference-counting node of the tree: a leaf of elements (height 0) or an
+     * internal node of up to {@code WIDTH} children with their cumulative element counts.
+     */
+    struct node
+    {
+        node() : _refs( 0 ) {}
+        node( node const& n ) : _refs( 0 ), _elems( n._elems ), _kids( n._kids ), _sizes( n._sizes )
+            { for ( auto k : _kids ) { acquire( k ); } }
+        ~node() { for ( auto k : _kids ) { release( k ); } }
+
+        /** Counter for tracking references to this node. */
+        std::size_t         _refs;
+        /** Elements of a leaf. */
+        std::vector<A>      _elems;
+        /** Children of an internal node. */
+        std::vector<node*>  _kids;
+        /** Number of elements under _kids[0..i], for each i. */
+        std::vector<std::size_t> _sizes;
+    };
+
+    // Tree of all but the last few elements, its height, the tail leaf and the total length.
+    node*       _root;
+    std::size_t _height;
+    node*       _tail;
+    std::size_t _size;
+
+    static node* acquire( node* n ) { if ( n ) { ++(n->_refs); } return n; }
+    static void  release( node* n ) { if ( n && !--(n->_refs) ) { delete n; } }
+
+    static constexpr std::size_t BITS = 5;
+    /** Extra nodes beyond the optimum tolerated along a concatenation seam before rebalancing. */
+    static constexpr std::size_t EXTRAS = 2;
+
+    std::size_t tail_size() const { return _tail ? _tail->_elems.size() : 0; }
+
+    /** Number of elements under a node of the given height. */
+    static std::size_t count( node const* n, std::size_t h )
+        { return !n ? 0 : h == 0 ? n->_elems.size() : n->_sizes.back(); }
+    /** Number of slots (elements or children) used in a node of the given height. */
+    static std::size_t slots( node const* n, std::size_t h ) { return h == 0 ? n->_elems.size() : n->_kids.size(); }
+
+    /** Index of the child of {@code n} holding element {@code i}; the radix guess is a lower bound. */
+    static std::size_t locate( node const* n, std::size_t h, std::size_t i )
+    {
+        auto j = std::min( i >> ( BITS * h ), n->_kids.size() - 1 );
+        while ( n->_sizes[j] <= i ) { ++j; }
+        return j;
+    }
+
+    /** Makes an internal node of height {@code h} from children, adopting their references. */
+    static node* branch( std::vector<node*> kids, std::size_t h )
+    {
+        auto n = new node();
+        n->_kids = std::move( kids );
+        std::size_t total = 0;
+        for ( auto k : n->_kids ) { n->_sizes.push_back( total += count( k, h - 1 ) ); }
+        return n;
+    }
+
+    /** Wraps a leaf in single-child nodes up to height {@code h}. */
+    static node* path( node* leaf, std::size_t h )
+    {
+        auto n = acquire( leaf );
+        for ( std::size_t k = 1; k <= h; ++k ) { n = acquire( branch( { n }, k ) ); }
+        --(n->_refs);
+        return n;
+    }
+
+    static node* assoc( node const* n, std::size_t h, std::size_t i, A x )
+    {
+        auto m = new node( *n );
+        if ( h == 0 ) {
+            m->_elems[i] = std::move( x );
+        } else {
+            auto j = locate( n, h, i );
+            auto k = acquire( assoc( n->_kids[j], h - 1, j > 0 ? i - n->_sizes[j - 1] : i, std::move( x ) ) );
+            release( m->_kids[j] );
+            m->_kids[j] = k;
+        }
+        return m;
+    }
+
+    /** Appends a leaf along the rightmost path, or returns nullptr if that path is full. */
+    static node* append_leaf( node const* n, std::size_t h, node* leaf )
+    {
+        if ( h == 0 ) { return nullptr; }
+        if ( h > 1 ) {
+            if ( auto k = append_leaf( n->_kids.back(), h - 1, leaf ) ) {
+                auto m = new node( *n );
+                release( m->_kids.back() );
+                m->_kids.back() = acquire( k );
+                m->_sizes.back() += leaf->_elems.size();
+                return m;
+            }
+        }
+        if ( n->_kids.size() == WIDTH ) { return nullptr; }
+        auto m = new node( *n );
+        m->_kids.push_back( acquire( path( leaf, h - 1 ) ) );
+        m->_sizes.push_back( m->_sizes.back() + leaf->_elems.size() );
+        return m;
+    }
+
+    /** Moves the (full) tail leaf into the tree. */
+    void push_tail()
+    {
+        auto leaf = _tail;
+        _tail = nullptr;
+        if ( !_root ) {
+            _root = leaf;
+            _height = 0;
+            return;
+        }
+        if ( auto r = append_leaf( _root, _height, leaf ) ) {
+            release( _root );
+            _root = acquire( r );
+        } else {
+            _root = acquire( branch( { _root, acquire( path( leaf, _height ) ) }, _height + 1 ) );
+            ++_height;
+        }
+        release( leaf );
+    }
+
+    /** Removes single-child roots. */
+    void collapse()
+    {
+        while ( _height > 0 && _root->_kids.size() == 1 ) {
+            auto r = acquire( _root->_kids[0] );
+            release( _root );
+            _root = r;
+            --_height;
+        }
+    }
+
+    /**
+     * Redistributes the slots of a run of sibling nodes of height {@code h} so that there are
+     * at most {@code EXTRAS} more of them than strictly necessary. Adopts and returns references.
+     */
+    static std::vector<node*> rebalance( std::vector<node*> ns, std::size_t h )
+    {
+        std::vector<std::size_t> plan;
+        std::size_t total = 0;
+        for ( auto n : ns ) { plan.push_back( slots( n, h ) ); total += plan.back(); }
+        auto optimal = ( total + WIDTH - 1 ) / WIDTH;
+        auto n = plan.size();
+        if ( n <= optimal + EXTRAS ) { return ns; }
+
+        std::size_t i = 0;
+        while ( n > optimal + EXTRAS ) {
+            while ( plan[i] > WIDTH - EXTRAS / 2 ) { ++i; }
+            auto r = plan[i];
+            while ( r > 0 ) {
+                auto fill = std::min( r + plan[i + 1], WIDTH );
+                plan[i] = fill;
+                r = r + plan[i + 1] - fill;
+                ++i;
+            }
+            for ( auto j = i; j + 1 < n; ++j ) { plan[j] = plan[j + 1]; }
+            --n;
+            --i;
+        }
+        plan.resize( n );
+
+        std::vector<node*> out;
+        std::size_t src = 0, off = 0;
+        for ( auto want : plan ) {
+            auto m = new node();
+            while ( slots( m, h ) < want ) {
+                auto from = ns[src];
+                auto take = std::min( want - slots( m, h ), slots( from, h ) - off );
+                if ( h == 0 ) {
+                    m->_elems.insert( m->_elems.end(), from->_elems.begin() + off, from->_elems.begin() + off + take );
+                } else {
+                    for ( std::size_t k = off; k < off + take; ++k ) { m->_kids.push_back( acquire( from->_kids[k] ) ); }
+                }
+                off += take;
+                if ( off == slots( from, h ) ) { ++src; off = 0; }
+            }
+            if ( h > 0 ) {
+                std::size_t sum = 0;
+                for ( auto k : m->_kids ) { m->_sizes.push_back( sum += count( k, h - 1 ) ); }
+            }
+            out.push_back( acquire( m ) );
+        }
+        for ( auto m : ns ) { release( m ); }
+        return out;
+    }
+
+    /**
+     * Concatenates two trees of heights {@code hl} and {@code hr} along their seam.
+     * @return one or two (owned) nodes of height max(hl, hr) holding all their elements
+     */
+    static std::vector<node*> concat( node* l, std::size_t hl, node* r, std::size_t hr )
+    {
+        if ( hl == 0 && hr == 0 ) {
+            if ( l->_elems.size() + r->_elems.size() <= WIDTH ) {
+                auto m = new node( *l );
+                m->_elems.insert( m->_elems.end(), r->_elems.begin(), r->_elems.end() );
+                return { acquire( m ) };
+            }
+            return { acquire( l ), acquire( r ) };
+        }
+        auto h = std::max( hl, hr );
+        std::vector<node*> seam;
+        if ( hl == h ) {
+            for ( std::size_t k = 0; k + 1 < l->_kids.size(); ++k ) { seam.push_back( acquire( l->_kids[k] ) ); }
+        }
+        auto mid = concat( hl == h ? l->_kids.back() : l, hl == h ? hl - 1 : hl,
+                           hr == h ? r->_kids.front() : r, hr == h ? hr - 1 : hr );
+        seam.insert( seam.end(), mid.begin(), mid.end() );
+        if ( hr == h ) {
+            for ( std::size_t k = 1; k < r->_kids.size(); ++k ) { seam.push_back( acquire( r->_kids[k] ) ); }
+        }
+        seam = rebalance( std::move( seam ), h - 1 );
+        if ( seam.size() <= WIDTH ) { return { acquire( branch( std::move( seam ), h ) ) }; }
+        std::vector<node*> rest( seam.begin() + WIDTH, seam.end() );
+        seam.resize( WIDTH );
+        return { acquire( branch( std::move( seam ), h ) ), acquire( branch( std::move( rest ), h ) ) };
+    }
+
+    /** First {@code k} elements (0 < k < count) under a node. */
+    static node* slice_left( node const* n, std::size_t h, std::size_t k )
+    {
+        auto m = new node();
+        if ( h == 0 ) {
+            m->_elems.assign( n->_elems.begin(), n->_elems.begin() + k );
+            return m;
+        }
+        auto j = locate( n, h, k - 1 );
+        auto before = j > 0 ? n->_sizes[j - 1] : 0;
+        for ( std::size_t c = 0; c < j; ++c ) { m->_kids.push_back( acquire( n->_kids[c] ) ); }
+        auto kid = n->_kids[j];
+        m->_kids.push_back( acquire( k - before == count( kid, h - 1 ) ? kid : slice_left( kid, h - 1, k - before ) ) );
+        std::size_t sum = 0;
+        for ( auto c : m->_kids ) { m->_sizes.push_back( sum += count( c, h - 1 ) ); }
+        return m;
+    }
+
+    /** All but the first {@code k} elements (0 < k < count) under a node. */
+    static node* slice_right( node const* n, std::size_t h, std::size_t k )
+    {
+        auto m = new node();
+        if ( h == 0 ) {
+            m->_elems.assign( n->_elems.begin() + k, n->_elems.end() );
+            return m;
+        }
+        auto j = locate( n, h, k );
+        auto before = j > 0 ? n->_sizes[j - 1] : 0;
+        auto kid = n->_kids[j];
+        m->_kids.push_back( acquire( k == before ? kid : slice_right( kid, h - 1, k - before ) ) );
+        for ( auto c = j + 1; c < n->_kids.size(); ++c ) { m->_kids.push_back( acquire( n->_kids[c] ) ); }
+        std::size_t sum = 0;
+        for ( auto c : m->_kids ) { m->_sizes.push_back( sum += count( c, h - 1 ) ); }
+        return m;
+    }
+
+    /** Applies {@code f} to each element in order. */
+    template <typename F>
+    void each( F&& f ) const
+    {
+        each( _root, _height, f );
+        if ( _tail ) { for ( auto const& x : _tail->_elems ) { f( x ); } }
+    }
+    template <typename F>
+    static void each( node const* n, std::size_t h, F& f )
+    {
+        if ( !n ) { return; }
+        if ( h == 0 ) {
+            for ( auto const& x : n->_elems ) { f( x ); }
+        } else {
+            for ( auto k : n->_kids ) { each( k, h - 1, f ); }
+        }
+    }
+
+    template <typename F, typename B>
+    static node* map_node( F& f, typename rrb_vector<B>::node const* n, std::size_t h )
+    {
+        auto m = new node();
+        if ( h == 0 ) {
+            m->_elems.reserve( n->_elems.size() );
+            for ( auto const& x : n->_elems ) { m->_elems.push_back( f( x ) ); }
+        } else {
+            for ( auto k : n->_kids ) { m->_kids.push_back( acquire( rrb_vector<A>::template map_node<F, B>( f, k, h - 1 ) ) ); }
+            m->_sizes = n->_sizes;
+        }
+        return m;
+    }
+
+    template <typename B> friend class rrb_vector;
+    template <typename B> friend std::size_t length( rrb_vector<B> const& );
+    template <typename B> friend std::size_t height( rrb_vector<B> const& );
+    template <typename B> friend rrb_vector<B> take( std::size_t, rrb_vector<B> const& );
+    template <typename B> friend rrb_vector<B> drop( std::size_t, rrb_vector<B> const& );
+    template <typename B> friend rrb_vector<B> operator+ ( rrb_vector<B> const&, rrb_vector<B> const& );
+    template <typename F, typename B> friend auto map( F, rrb_vector<B> const& xs ) -> rrb_vector<decltype( std::declval<F&>()( xs[0] ) )>;
+    template <typename P, typename B> friend rrb_vector<B> filter( P, rrb_vector<B> const& );
+    template <typename B> friend B sum( rrb_vector<B> const& );
+    template <typename B> friend rrb_vector<B> reverse( rrb_vector<B> const& );
+    template <typename B> friend bool operator== ( rrb_vector<B> const&, rrb_vector<B> const& );
+    template <typename B> friend std::ostream& operator<< ( std::ostream&, rrb_vector<B> const& );
+};
+
+/**
+ * Test whether a vector is empty.
+ * @param xs a vector
+ * @return true if {@code xs} is empty, false otherwise
+ */
+template <typename A>
+inline bool null( rrb_vector<A> const& xs ) { return !xs; }
+
+/**
+ * Returns the length of a vector. This operation has time complexity O(1).
+ * @param xs a vector
+ * @return the number of elements in {@code xs}
+ */
+template <typename A>
+inline std::size_t length( rrb_vector<A> const& xs ) { return xs._size; }
+
+/**
+ * Returns the height of the tree holding a vector's elements, apart from the tail leaf: zero
+ * for a single leaf. For tests and diagnostics of the tree's shape.
+ * @param xs a vector
+ * @return the number of levels of internal nodes above the leaves of {@code xs}
+ */
+template <typename A>
+inline std::size_t height( rrb_vector<A> const& xs ) { return xs._height; }
+
+/**
+ * Constructs a vector by appending an element to an existing vector.
+ * @param xs a vector
+ * @param x an element
+ * @return a vector with {@code x} after the elements of {@code xs}
+ */
+template <typename A>
+inline rrb_vector<A> snoc( rrb_vector<A> const& xs, A x ) { return xs.push_back( std::move( x ) ); }
+
+/**
+ * Gets the leading subvector of the given length in O(log32 n).
+ * @param k a non-negative integer
+ * @param xs a vector
+ * @return a subvector of {@code xs} with at most {@code k} elements
+ */
+template <typename A>
+inline rrb_vector<A> take( std::size_t k, rrb_vector<A> const& xs )
+{
+    using node = typename rrb_vector<A>::node;
+
+    if ( k >= xs._size ) { return xs; }
+    if ( k == 0 ) { return rrb_vector<A>(); }
+    rrb_vector<A> ys( xs );
+    auto tree = xs._size - xs.tail_size();
+    if ( k > tree ) {
+        auto t = new node();
+        t->_elems.assign( xs._tail->_elems.begin(), xs._tail->_elems.begin() + ( k - tree ) );
+        rrb_vector<A>::release( ys._tail );
+        ys._tail = rrb_vector<A>::acquire( t );
+    } else {
+        rrb_vector<A>::release( ys._tail );
+        ys._tail = nullptr;
+        if ( k < tree ) {
+            auto r = rrb_vector<A>::acquire( rrb_vector<A>::slice_left( xs._root, xs._height, k ) );
+            rrb_vector<A>::release( ys._root );
+            ys._root = r;
+            ys.collapse();
+        }
+    }
+    ys._size = k;
+    return ys;
+}
+
+/**
+ * Gets what remains of a vector after its first {@code k} elements, in O(log32 n).
+ * @param k a non-negative integer
+ * @param xs a vector
+ * @return a subvector of {@code xs} without its first {@code k} elements
+ */
+template <typename A>
+inline rrb_vector<A> drop( std::size_t k, rrb_vector<A> const& xs )
+{
+    using node = typename rrb_vector<A>::node;
+
+    if ( k == 0 ) { return xs; }
+    if ( k >= xs._size ) { return rrb_vector<A>(); }
+    rrb_vector<A> ys( xs );
+    auto tree = xs._size - xs.tail_size();
+    if ( k >= tree ) {
+        auto t = new node();
+        t->_elems.assign( xs._tail->_elems.begin() + ( k - tree ), xs._tail->_elems.end() );
+        rrb_vector<A>::release( ys._root );
+        rrb_vector<A>::release( ys._tail );
+        ys._root = nullptr;
+        ys._height = 0;
+        ys._tail = rrb_vector<A>::acquire( t );
+    } else {
+        auto r = rrb_vector<A>::acquire( rrb_vector<A>::slice_right( xs._root, xs._height, k ) );
+        rrb_vector<A>::release( ys._root );
+        ys._root = r;
+        ys.collapse();
+    }
+    ys._size -= k;
+    return ys;
+}
+
+/**
+ * Extract the first element of a vector, which must be non-empty.
+ * @param xs a non-empty vector
+ * @return the first element of {@code xs}
+ * @throws std::domain_error if {@code xs} is empty
+ */
+template <typename A>
+inline A head( rrb_vector<A> const& xs )
+{
+    if ( null( xs ) ) { throw std::domain_error("prelude::head: empty list"); }
+    return xs[0];
+}
+
+/**
+ * Extract the elements after the head of a vector, which must be non-empty.
+ * @param xs a non-empty vector
+ * @return a vector containing all but the first element of {@code xs}
+ * @throws std::domain_error if {@code xs} is empty
+ */
+template <typename A>
+inline rrb_vector<A> tail( rrb_vector<A> const& xs )
+{
+    if ( null( xs ) ) { throw std::domain_error("prelude::tail: empty list"); }
+    return drop( 1, xs );
+}
+
+/**
+ * Appends one vector to another in O(log32 n), sharing all but the nodes along the seam.
+ * @param xs a vector
+ * @param ys a vector
+ * @return a vector in which the elements of {@code xs} precede the elements of {@code ys}
+ */
+template <typename A>
+inline rrb_vector<A> operator+ ( rrb_vector<A> const& xs, rrb_vector<A> const& ys )
+{
+    if ( null( xs ) ) { return ys; }
+    if ( null( ys ) ) { return xs; }
+    if ( !ys._root ) {
+        auto zs = xs;
+        for ( auto const& y : ys._tail->_elems ) { zs = zs.push_back( y ); }
+        return zs;
+    }
+    auto zs = xs;
+    if ( zs._tail ) { zs.push_tail(); }
+    auto roots = rrb_vector<A>::concat( zs._root, zs._height, ys._root, ys._height );
+    rrb_vector<A>::release( zs._root );
+    zs._height = std::max( zs._height, ys._height );
+    if ( roots.size() == 1 ) {
+        zs._root = roots[0];
+    } else {
+        zs._root = rrb_vector<A>::acquire( rrb_vector<A>::branch( std::move( roots ), zs._height + 1 ) );
+        ++zs._height;
+    }
+    zs.collapse();
+    zs._tail = rrb_vector<A>::acquire( ys._tail );
+    zs._size += ys._size;
+    return zs;
+}
+
+/**
+ * Converts a vector of one type to that of another by applying a specified function,
+ * preserving the shape of the tree.
+ * @param f function that takes an element of {@code xs} and returns a different type
+ * @param xs a vector
+ * @return a vector of elements the same type as the return type of {@code f}
+ */
+template <typename F, typename A>
+inline auto map( F f, rrb_vector<A> const& xs ) -> rrb_vector<decltype( std::declval<F&>()( xs[0] ) )>
+{
+    using B = decltype( std::declval<F&>()( xs[0] ) );
+
+    rrb_vector<B> ys;
+    if ( xs._root ) { ys._root = rrb_vector<B>::acquire( rrb_vector<B>::template map_node<F, A>( f, xs._root, xs._height ) ); }
+    if ( xs._tail ) { ys._tail = rrb_vector<B>::acquire( rrb_vector<B>::template map_node<F, A>( f, xs._tail, 0 ) ); }
+    ys._height = xs._height;
+    ys._size = xs._size;
+    return ys;
+}
+
+/**
+ * {@code filter}, applied to a predicate and a vector, returns the vector of
+ * those elements that satisfy the predicate.
+ * @param pred a predicate function
+ * @param xs a vector
+ * @return a vector containing those elements of {@code xs} satisfying {@code pred}
+ */
+template <typename P, typename A>
+inline rrb_vector<A> filter( P pred, rrb_vector<A> const& xs )
+{
+    rrb_vector<A> ys;
+    xs.each( [&]( A const& x ){ if ( pred( x ) ) { ys = ys.push_back( x ); } } );
+    return ys;
+}
+
+/**
+ * The {@code sum} function computes the sum of a vector of numbers.
+ * @param xs a vector
+ * @return the sum of each element of {@code xs}
+ */
+template <typename A>
+inline A sum( rrb_vector<A> const& xs )
+{
+    A result = 0;
+    xs.each( [&result]( A const& x ){ result += x; } );
+    return result;
+}
+
+/**
+ * Reverses a vector.
+ * @param xs a vector
+ * @return a vector whose elements are the same as {@code xs} but in reverse order
+ */
+template <typename A>
+inline rrb_vector<A> reverse( rrb_vector<A> const& xs )
+{
+    std::vector<A> buf;
+    buf.reserve( xs._size );
+    xs.each( [&buf]( A const& x ){ buf.push_back( x ); } );
+    rrb_vector<A> ys;
+    for ( auto i = buf.rbegin(); i != buf.rend(); ++i ) { ys = ys.push_back( *i ); }
+    return ys;
+}
+
+/**
+ * Element-wise equality of vectors.
+ */
+template <typename A>
+inline bool operator== ( rrb_vector<A> const& xs, rrb_vector<A> const& ys )
+{
+    if ( xs._size != ys._size ) { return false; }
+    std::size_t i = 0;
+    bool same = true;
+    xs.each( [&]( A const& x ){ same = same && x == ys[i++]; } );
+    return same;
+}
+
+/**
+ * Inserts a character string serialization of a vector into an output stream.
+ * @param os an output stream
+ * @param xs a vector
+ * @return a reference to the output stream
+ */
+template <typename A>
+std::ostream& operator<< ( std::ostream& os, rrb_vector<A> const& xs )
+{
+    bool first = true;
+    os << '[';
+    xs.each( [&]( A const& x ){ if ( !first ) { os << ','; } os << x; first = false; } );
+    return os << ']';
+}
+
+} // end namespace prelude
+
+#endif //HPP_PRELUDE_VECTOR
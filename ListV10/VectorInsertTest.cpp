@@ -0,0 +1,32 @@
+#include <iostream>
+#include <iomanip>
+
+#include "Vector.hpp"
+
+using namespace prelude;
+
+// Persistent counterpart of ListV8/ListInsertTest.cpp: each round inserts into a new
+// version after position 49, sharing everything else with the original.
+using seq = rrb_vector<int>;
+
+int main(int argc, char** argv)
+{
+    auto n = std::stoi(argv[1]);
+    auto m = std::stof(argv[2]) + 1.f;
+
+    seq xs;
+    for (auto i = 1; i <= n; ++i) {
+        xs = xs.push_back( i );
+    }
+
+    auto z = 0L;
+    for (auto j = 0; j <= m; ++j ) {
+        auto ys = take( 50, xs ).push_back( j ) + drop( 50, xs );
+        ys = ys.update( n / 2, j );
+        z += ys[50] + ys[n / 2];
+    }
+
+    std::cout << xs[50] << ' ' << z << std::endl;
+
+    return 0;
+}
@@ -1,137 +1,229 @@
 #ifndef HPP_PRELUDE_LIST
 #define HPP_PRELUDE_LIST
 
+#include <cstddef>
+#include <initializer_list>
+#include <ostream>
 #include <stdexcept>
+#include <utility>
 
 /**
- * Implementation of Haskell-like, functional programming idioms, particularly recursive Lists.
+ * Implementation of Haskell-like, functional programming idioms, particularly recursive lists.
  */
 namespace prelude {
 
-template <typename A> class List;
+template <typename A> class list;
 
 /**
- * Family of recursively-defined homogeneous list types.
- * Lists create via constructor or the cons operator (overloaded |) use
- * shallow copy for the tail, which helps ease the storage burden for
- * memory-heavy element types.
- * 
- * @author Matthew A Johnson
- * @version 1.0
+ * Internal node structure shared by the empty and non-empty nodes of a list: a reference
+ * count and the node holding the rest of the list. Every list ends at the one static
+ * {@code _list_empty} node of its element type rather than at nullptr, so "empty" is a
+ * node type of its own, told apart by address rather than by a virtual call.
  */
-
-template <typename A> class list;
-
 template <typename A>
-struct _list_base
+struct _list_node
 {
-    virtual auto head() const -> A const& = 0;
-    virtual auto tail() const -> list<A>  = 0;
+    /** Counter for tracking references to this node (never consulted for the empty node). */
+    size_t         _refs;
+    /** Node containing the rest of the list. */
+    _list_node<A>* _tail;
 };
 
+/**
+ * The node type of the empty list. It holds no element and there is exactly one instance
+ * per element type, whose tail is itself.
+ */
 template <typename A>
-struct _list_empty : public _list_base
+struct _list_empty : _list_node<A>
 {
-    virtual auto head() const -> A const& { throw std::domain_error("prelude::head: empty list"); }
-    virtual auto tail() const -> list<A>  { throw std::domain_error("prelude::tail: empty list"); }
+    /** The empty node of element type {@code A}. */
+    static _list_empty instance;
+
+private:
+    constexpr _list_empty() : _list_node<A>{ 0, this } {}
 };
 
 template <typename A>
-class list : public _list_base
+_list_empty<A> _list_empty<A>::instance {};
+
+/**
+ * The node type of a non-empty list, holding its first element.
+ */
+template <typename A>
+struct _list_cons : _list_node<A>
 {
-    struct node;
-    node* _rep;
-public:
     /**
-     * Internal node structure for a list.
-     * @note required so that List can provide a distinct empty-list value
+     * Make an internal list node from an element and a node, taking a claim on the node.
+     * @param x  an element
+     * @param xs an existing node
      */
-    struct node {};
+    _list_cons( A x, _list_node<A>* xs ) : _list_node<A>{ 0, xs }, _head( std::move( x ) ) {}
 
-    class empty_node : public node
+    /** The value of an element. */
+    A const _head;
+};
+
+/**
+ * Statically dispatched list interface (CRTP). Derived is a list type exposing its first
+ * node as {@code _rep}; the emptiness test is a pointer comparison against the static empty
+ * node, and {@code head}/{@code tail} are ordinary inline member functions, so list nodes
+ * carry no vtable pointer and element access involves no indirect call.
+ */
+template <typename Derived, typename A>
+struct _list_base
+{
+    /**
+     * Tests whether this list is empty.
+     * @return true if this list is empty, false otherwise
+     */
+    bool null() const { return self()._rep == &_list_empty<A>::instance; }
+    /**
+     * Gets the first element of this list.
+     * @return the first element of this list
+     * @throws std::domain_error if this list is empty
+     */
+    A const& head() const
     {
-        explicit empty_node() {}
-    };
-    struct nonempty_node : public node
+        if ( null() ) { throw std::domain_error("prelude::head: empty list"); }
+        return static_cast<_list_cons<A> const*>( self()._rep )->_head;
+    }
+    /**
+     * Gets all elements after the first element of this list.
+     * @return a list containing all but the first element of this list
+     * @throws std::domain_error if this list is empty
+     */
+    Derived tail() const
     {
-        /**
-         * Make an internal list node from an element and a pointer to a node.
-         * @param x  an element
-         * @param xs pointer to an existing node (or nullptr)
-         */
-        explicit Node( A x, Node* xs ) : _refs( 0 ), _head( x ), _tail( acquire( xs ) ) {}
-        /**
-         * Make an internal list node from an element and a pointer to a node.
-         * @param x  an element
-         * @param xs pointer to an existing node (or nullptr)
-         */
-        explicit Node( A x )           : _refs( 0 ), _head( x ), _tail( nullptr )       {}
-
-        Node( Node const& n )          : _refs( 0 ),       _head( n._head ),              _tail( acquire( n._tail ) ) {}
-        Node( Node &&     n ) noexcept : _refs( n._refs ), _head( std::move( n._head ) ), _tail( n._tail )            { n._tail = nullptr; }
-
-        /** Destroy this element and relinquish a claim on the tail. */
-        ~Node() { release( _tail ); }
-
-        /** Counter for tracking references to this element. */
-        size_t  _refs;
-        /** The value of an element. */
-        A const _head;
-        /** Node containing the next element. */
-        Node*   _tail;
-    };
-
-    static node const EMPTY;
-
-    List( A           x  )          : List( x, EMPTY )           {}
-    List( List const& xs )          : _rep( acquire( xs._rep ) ) {}
-    List( List &&     xs ) noexcept : _rep( xs._rep )            { xs._rep = nullptr; }
-    
-    ~List() { release( _rep ); }
-
-    List& operator= ( List const& xs ) { if ( _rep != xs._rep ) { release( _rep ); _rep = acquire( xs._rep ); } return *this; }
-    List& operator= ( List && xs ) { release( _rep ); _rep = xs._rep; xs._rep = nullptr; return *this; }
-
-    operator bool() { return static_cast<bool>(_rep); }
-
-//private:
-    Node* _rep;
-
-    List( A x, List const& xs ) : _rep( acquire( new Node( x, xs._rep ) ) ) {}
-    List( A x, List &&     xs ) : _rep( acquire( new Node( std::move( x ) ) ) ) { _rep->_tail = xs._rep; }
-    List( Node* n ) : _rep( acquire( n ) ) {}
-    List()          : _rep( nullptr ) {}
-
-    static Node* acquire( Node* n ) { if ( n ) { ++(n->_refs); } return n; }
-    static Node* release( Node* n ) { if ( n ) { if ( !--(n->_refs) ) { delete n; } } return n; }
-
-    List clone()
-	{
-  		auto zs = List<A>( this->_rep->_head );
-	  	auto from = this->_rep;
-	  	auto to = zs._rep;
-  		while ( (from = from->_tail) ) {
-    		to = to->_tail = List<A>::acquire( new typename List<A>::Node( from->_head ) );
-	  	}
-		return zs;
+        if ( null() ) { throw std::domain_error("prelude::tail: empty list"); }
+        return Derived( self()._rep->_tail );
     }
 
-    template <typename B> friend bool    null( List<B> );
-    template <typename B> friend B       head( List<B> );
-    template <typename B> friend List<B> tail( List<B> );
-    template <typename B> friend List<B> cons( B x, List<B> );
-    template <typename B> friend List<B> operator| ( B x, List<B> );
-    template <typename B> friend std::ostream& operator<< ( std::ostream& os, List<B> const& xs );
-    template <typename F, typename B> friend auto map( F f, List<B> const& xs ) -> List<decltype( f( head( xs ) ) )>;
-    template <typename B> friend B sum( List<B> const& xs );
+private:
+    Derived const& self() const { return static_cast<Derived const&>( *this ); }
 };
 
-/** Typed empty list constant - class scoped. */
+/**
+ * Family of immutable, recursively-defined, homogeneous list types.
+ * Lists create via constructor or the cons operator (overloaded |) use
+ * shallow copy for the tail, which helps ease the storage burden for
+ * memory-heavy element types.
+ *
+ * @author Matthew A Johnson
+ * @version 1.0
+ */
 template <typename A>
-List<A> const List<A>::EMPTY {};
-/** Typed empty list constant - namespace scoped. */
+class list : public _list_base<list<A>, A>
+{
+    using node = _list_node<A>;
+    using cons_node = _list_cons<A>;
+public:
+    /**
+     * Constructs a singleton list containing the specified element.
+     * @param x the element to be stored in this list
+     */
+    list( A x ) : _rep( acquire( new cons_node( std::move( x ), nil() ) ) ) {}
+    /**
+     * Makes a shallow copy of the specified list, sharing ownership of its nodes.
+     * @param xs the existing list to be copied
+     */
+    list( list const& xs ) : _rep( acquire( xs._rep ) ) {}
+    /**
+     * Move-constructor for lists; leaves {@code xs} empty.
+     * @param xs the r-value list to be moved
+     */
+    list( list && xs ) noexcept : _rep( xs._rep ) { xs._rep = nil(); }
+    /**
+     * Constructs a finite list using standard uniform initialization.
+     * @param xs a comma-separated list of values that will be elements of this list
+     */
+    list( std::initializer_list<A> xs ) : _rep( nil() )
+        {
+            for ( auto i = xs.end(); i-- != xs.begin(); ) {
+                _rep = acquire( new cons_node( *i, _rep ) );
+            }
+        }
+    /**
+     * Destroys this list and any referenced nodes for which this list was sole owner.
+     */
+    ~list() { release( _rep ); }
+
+    list& operator= ( list const& xs )
+        { if ( _rep != xs._rep ) { release( _rep ); _rep = acquire( xs._rep ); } return *this; }
+    list& operator= ( list && xs ) noexcept
+        { std::swap( _rep, xs._rep ); return *this; }
+
+    /**
+     * Casting operator permits type-conversion from list to boolean for use in test expressions.
+     */
+    explicit operator bool() const { return _rep != nil(); }
+
+private:
+    // The first node of this list; the static empty node when this list is empty.
+    node* _rep;
+
+    /**
+     * `Cons`-constructor, for internal use only.
+     */
+    list( A x, list xs ) : _rep( new cons_node( std::move( x ), xs._rep ) ) { xs._rep = nil(); acquire( _rep ); }
+    /**
+     * Constructs a list sharing the specified node, for internal use only.
+     */
+    explicit list( node* n ) : _rep( acquire( n ) ) {}
+    /**
+     * Constructs an empty list, for internal use only; the global {@code empty}
+     * function is provided for general usage.
+     */
+    list() : _rep( nil() ) {}
+
+    /** The static empty node terminating every list of this element type. */
+    static node* nil() { return &_list_empty<A>::instance; }
+
+    /** Auxiliary function for incrementing a node's reference count. */
+    static node* acquire( node* n ) { if ( n != nil() ) { ++(n->_refs); } return n; }
+    /**
+     * Auxiliary function for decrementing a node's reference count and deleting if necessary,
+     * iterating down the tail so that dropping a long list cannot overflow the stack.
+     */
+    static void release( node* n )
+    {
+        while ( n != nil() && !--(n->_refs) ) {
+            auto next = n->_tail;
+            delete static_cast<cons_node*>( n );
+            n = next;
+        }
+    }
+
+    /**
+     * Auxiliary function for building lists front to back: stores a new node holding {@code x}
+     * at {@code to} (the first node or the tail of the last) and returns where the next one goes.
+     */
+    static node** snoc( node** to, A x ) { *to = acquire( new cons_node( std::move( x ), nil() ) ); return &(*to)->_tail; }
+    /** Auxiliary function for the element of a non-empty node. */
+    static A const& value( node const* n ) { return static_cast<cons_node const*>( n )->_head; }
+
+    template <typename D, typename B> friend struct _list_base;
+    template <typename B> friend list<B> const& empty();
+    template <typename B> friend list<B> operator| ( B, list<B> );
+    template <typename B> friend std::ostream& operator<< ( std::ostream&, list<B> const& );
+    template <typename F, typename B> friend auto map( F f, list<B> const& xs ) -> list<decltype( f( head( xs ) ) )>;
+    template <typename B> friend list<B> operator+ ( list<B> const&, list<B> const& );
+    template <typename P, typename B> friend list<B> filter( P, list<B> const& );
+    template <typename B> friend B const& last( list<B> const& );
+    template <typename B> friend list<B> init( list<B> const& );
+    template <typename B> friend size_t length( list<B> const& );
+    template <typename B> friend list<B> reverse( list<B> const& );
+    template <typename B> friend B sum( list<B> const& );
+    template <typename B> friend list<B> take( unsigned, list<B> const& );
+    template <typename B> friend list<B> drop( unsigned, list<B> const& );
+    template <typename B> friend bool operator== ( list<B> const&, list<B> const& );
+};
+
+/**
+ * Typed empty list constant.
+ * @return the empty list of element type {@code A}
+ */
 template <typename A>
-List<A> const& EMPTY = List<A>::EMPTY;
+inline list<A> const& empty() { static list<A> const EMPTY; return EMPTY; }
 
 /**
  * Constructs a list by pre-pending an element to an existing list.
@@ -140,15 +232,41 @@ List<A> const& EMPTY = List<A>::EMPTY;
  * @return a list with <var>x</var> at the head and <var>xs</var> as the tail
  */
 template <typename A>
-inline List<A> cons( A x, List<A> xs ) { return List<A>( x, xs ); }
+inline list<A> operator| ( A x, list<A> xs ) { return list<A>( std::move( x ), std::move( xs ) ); }
 /**
- * Constructs a list by pre-pending an element to an existing list (operator version).
+ * Constructs a list by pre-pending an element to an existing list.
  * @param x an element
  * @param xs a list
  * @return a list with <var>x</var> at the head and <var>xs</var> as the tail
  */
 template <typename A>
-inline List<A> operator| ( A x, List<A> xs ) { return List<A>( x, xs ); }
+inline list<A> cons( A x, list<A> xs ) { return std::move( x ) | std::move( xs ); }
+
+/**
+ * Tests whether a list is empty.
+ * @param xs a list
+ * @return true if <var>xs</var> is empty, false otherwise
+ */
+template <typename A>
+inline bool null( list<A> const& xs ) { return xs.null(); }
+
+/**
+ * Extracts the first element of a list.
+ * @param xs a non-empty list
+ * @return the first element of <var>xs</var>
+ * @throws std::domain_error if <var>xs</var> is empty
+ */
+template <typename A>
+inline A const& head( list<A> const& xs ) { return xs.head(); }
+
+/**
+ * Extracts all elements after the head of a list.
+ * @param xs a non-empty list
+ * @return a list containing all but the first element of <var>xs</var>
+ * @throws std::domain_error if <var>xs</var> is empty
+ */
+template <typename A>
+inline list<A> tail( list<A> const& xs ) { return xs.tail(); }
 
 // List operations
 
@@ -160,77 +278,47 @@ inline List<A> operator| ( A x, List<A> xs ) { return List<A>( x, xs ); }
  * @return a list of elements the same type as the return type of <var>f</var>
  */
 template <typename F, typename A>
-inline auto map( F f, List<A> const& xs ) -> List<decltype( f( head( xs ) ) )>
-{
-	using B = decltype( f( head(xs) ) );
-  	using Node = typename List<B>::Node;
-
-  	if ( null( xs ) ) { return EMPTY<B>; }
-
-  	auto ys = List<B>( f( xs._rep->_head ) );
-  	auto from = xs._rep;
-  	auto to = ys._rep;
-  	while ( (from = from->_tail) ) {
-    	to = to->_tail = List<B>::acquire( new Node( f( from->_head ) ) );
-  	}
-  	return ys;
-}
-
-/**
- * Appends one list to another.
- * @param xs a list
- * @param ys a list
- * @return a list in which the elements of <var>xs</var> precede the elements of <var>ys</var>
- * @note element order is preserved
- */
-template <typename A>
-inline List<A> append( List<A> const& xs, List<A> const& ys )
+inline auto map( F f, list<A> const& xs ) -> list<decltype( f( head( xs ) ) )>
 {
-  	using Node = typename List<A>::Node;
+    using B = decltype( f( head( xs ) ) );
 
-    if ( null( xs ) ) { return ys; }
-
-  	auto zs = List<A>( xs._rep->_head );
-  	auto from = xs._rep;
-  	auto to = zs._rep;
-  	while ( (from = from->_tail) ) {
-    	to = to->_tail = List<A>::acquire( new Node( from->_head ) );
-  	}
-    to->_tail = ys._rep;
-  	return zs;
+    list<B> ys;
+    auto to = &ys._rep;
+    for ( auto from = xs._rep; from != list<A>::nil(); from = from->_tail ) {
+        to = list<B>::snoc( to, f( list<A>::value( from ) ) );
+    }
+    return ys;
 }
 
 /**
- * Appends one list to another (move-version).
+ * Appends one list to another.
  * @param xs a list
  * @param ys a list
  * @return a list in which the elements of <var>xs</var> precede the elements of <var>ys</var>
  * @note element order is preserved
  */
 template <typename A>
-inline List<A> append( List<A> && xs, List<A> const& ys )
+inline list<A> operator+ ( list<A> const& xs, list<A> const& ys )
 {
     if ( null( xs ) ) { return ys; }
 
-  	auto zs = std::move( xs );
-  	auto to = zs._rep;
-  	while ( (to = to->_tail) ) {}
-    to->_tail = ys._rep;
-  	return zs;
+    list<A> zs;
+    auto to = &zs._rep;
+    for ( auto from = xs._rep; from != list<A>::nil(); from = from->_tail ) {
+        to = list<A>::snoc( to, list<A>::value( from ) );
+    }
+    *to = list<A>::acquire( ys._rep );
+    return zs;
 }
 
 /**
- * Appends one list to another (operator variant).
+ * Appends one list to another.
  * @param xs a list
  * @param ys a list
  * @return a list in which the elements of <var>xs</var> precede the elements of <var>ys</var>
- * @note element order is preserved
  */
 template <typename A>
-inline List<A> operator+ ( List<A> xs, List<A> const& ys )
-{
-    return append( std::forward( xs ), ys );
-}
+inline list<A> append( list<A> const& xs, list<A> const& ys ) { return xs + ys; }
 
 /**
  * Extracts a sublist of those elements satisfying the given predicate.
@@ -239,91 +327,50 @@ inline List<A> operator+ ( List<A> xs, List<A> const& ys )
  * @return a list containing those elements of <var>xs</var> satisfying <var>pred</var>
  */
 template <typename P, typename A>
-inline List<A> filter( P pred, List<A> xs )
-{
-  	using Node = typename List<A>::Node;
-
-	List<A> ys;
-	auto to = ys._rep;
-  	auto from = xs._rep;
-
-	while ( from ) {
-    	if ( pred( from->_head ) ) {
-			to = to->_tail = List<A>::acquire( new Node( from->_head ) );
-    	} 
-    	from = from->_tail;
-  	} 
-  	return ys;
-}
-
-/**
- * Extracts the first element of a list.
- * @param xs a non-empty list
- * @return the first element of <var>xs</var>
- */
-template <typename A>
-inline A head( List<A> xs )
+inline list<A> filter( P pred, list<A> const& xs )
 {
-  if ( null( xs ) ) { throw std::domain_error("prelude::head: empty list"); }
-  return xs._rep->_head;
+    list<A> ys;
+    auto to = &ys._rep;
+    for ( auto from = xs._rep; from != list<A>::nil(); from = from->_tail ) {
+        if ( pred( list<A>::value( from ) ) ) { to = list<A>::snoc( to, list<A>::value( from ) ); }
+    }
+    return ys;
 }
 
 /**
  * Extracts the last element of a list.
  * @param xs a non-empty list
  * @return the last element of <var>xs</var>
+ * @throws std::domain_error if <var>xs</var> is empty
  */
 template <typename A>
-inline A last( List<A> xs )
-{
-  if ( null( xs ) ) { throw std::domain_error("prelude::last: empty list"); }
-
-  auto ys = tail( xs );
-  if ( null( ys ) ) {
-    return head( xs );
-  } else {
-    return last( ys );
-  }
-}
-
-/**
- * Extracts all elements after the head of a list.
- * @param xs a non-empty list
- * @return a list containing all but the first element of <var>xs</var>
- */
-template <typename A>
-inline List<A> tail( List<A> xs )
+inline A const& last( list<A> const& xs )
 {
-  if ( null( xs ) ) { throw std::domain_error("prelude::tail: empty list"); }
-  return List<A>( xs._rep->_tail );
+    if ( null( xs ) ) { throw std::domain_error("prelude::last: empty list"); }
+    auto e = xs._rep;
+    while ( e->_tail != list<A>::nil() ) { e = e->_tail; }
+    return list<A>::value( e );
 }
 
 /**
  * Extracts all except the last element of a list.
  * @param xs a non-empty list
  * @return a list containing all but the last element of <var>xs</var>
+ * @throws std::domain_error if <var>xs</var> is empty
  */
 template <typename A>
-inline List<A> init( List<A> xs )
+inline list<A> init( list<A> const& xs )
 {
-  if ( null( xs ) ) { throw std::domain_error("prelude::init: empty list"); }
+    if ( null( xs ) ) { throw std::domain_error("prelude::init: empty list"); }
 
-  auto ys = tail( xs );
-  if ( null( ys ) ) {
+    list<A> ys;
+    auto to = &ys._rep;
+    for ( auto from = xs._rep; from->_tail != list<A>::nil(); from = from->_tail ) {
+        to = list<A>::snoc( to, list<A>::value( from ) );
+    }
     return ys;
-  } else {
-    return head( xs ) | init( ys );
-  }
 }
 
-/**
- * Tests whether a list is empty.
- * @param xs a list
- * @return true if <var>xs</var> is empty, false otherwise
- */
-template <typename A>
-inline bool null( List<A> xs ) { return !xs; }
-
 /**
  * Computes the length of a list.
  * @param xs a list
@@ -331,14 +378,10 @@ inline bool null( List<A> xs ) { return !xs; }
  * @note This operation has time complexity O(n).
  */
 template <typename A>
-inline size_t length( List<A> xs )
+inline size_t length( list<A> const& xs )
 {
     size_t n = 0;
-    auto e = xs._rep;
-    while ( e ) {
-        ++n;
-        e = e->_tail;
-    }
+    for ( auto e = xs._rep; e != list<A>::nil(); e = e->_tail ) { ++n; }
     return n;
 }
 
@@ -348,39 +391,27 @@ inline size_t length( List<A> xs )
  * @return a list whose elements are the same as <var>xs</var> but in reverse order
  */
 template <typename A>
-inline List<A> reverse( List<A> const& xs )
+inline list<A> reverse( list<A> const& xs )
 {
-  	using Node = typename List<A>::Node;
-
-	auto from = xs._rep;
-
-  	if ( !from ) return xs;
-
-	auto to = new Node( from->_head );
-
-  	while ( (from = from->_tail) ) {
-		to = new Node( from->_head, to );
-  	}
-  	return List<A>( to );
+    list<A> ys;
+    for ( auto from = xs._rep; from != list<A>::nil(); from = from->_tail ) {
+        ys._rep = list<A>::acquire( new typename list<A>::cons_node( list<A>::value( from ), ys._rep ) );
+    }
+    return ys;
 }
 
 // Special folds
 
 /**
- * Extracts a sublist of those elements satisfying the given predicate.
- * @param pred a predicate function
+ * Computes the sum of a list of numbers.
  * @param xs a list
- * @return a list containing those elements of <var>xs</var> satisfying <var>pred</var>
+ * @return the sum of each element of <var>xs</var>
  */
 template <typename A>
-inline A sum( List<A> const& xs )
+inline A sum( list<A> const& xs )
 {
     A result = 0;
-    auto e = xs._rep;
-    while ( e ) {
-        result += e->_head;
-        e = e->_tail;
-    }
+    for ( auto e = xs._rep; e != list<A>::nil(); e = e->_tail ) { result += list<A>::value( e ); }
     return result;
 }
 
@@ -394,19 +425,14 @@ inline A sum( List<A> const& xs )
  * @note returns an empty list if <var>xs</var> is empty
  */
 template <typename A>
-inline List<A> take( unsigned k, List<A> const& xs )
+inline list<A> take( unsigned k, list<A> const& xs )
 {
-  	using Node = typename List<A>::Node;
-
-  	auto from = xs._rep;
-  	if ( k <= 0 || !from ) { return EMPTY<A>; }
-
-	auto ys = List<A>( from->_head );
-	auto to = ys._rep;
-  	while ( --k > 0 && (from = from->_tail) ) {
-		to = to->_tail = List<A>::acquire( new Node( from->_head ) );
-	}
-  	return ys;
+    list<A> ys;
+    auto to = &ys._rep;
+    for ( auto from = xs._rep; k > 0 && from != list<A>::nil(); --k, from = from->_tail ) {
+        to = list<A>::snoc( to, list<A>::value( from ) );
+    }
+    return ys;
 }
 
 /**
@@ -417,12 +443,28 @@ inline List<A> take( unsigned k, List<A> const& xs )
  * @note returns an empty list if <var>xs</var> has fewer than <var>k</var> elements
  */
 template <typename A>
-inline List<A> drop( unsigned k, List<A> const& xs )
+inline list<A> drop( unsigned k, list<A> const& xs )
 {
-	if ( k <= 0 ) { return xs; }
-	auto to = xs._rep;
-	while ( k-- > 0 && to ) { to = to->_tail; }
-  	return List<A>( to );
+    auto to = xs._rep;
+    while ( k-- > 0 && to != list<A>::nil() ) { to = to->_tail; }
+    return list<A>( to );
+}
+
+/**
+ * Compares two lists element by element.
+ * @param xs a list
+ * @param ys a list
+ * @return true if <var>xs</var> and <var>ys</var> have equal elements in the same order
+ */
+template <typename A>
+inline bool operator== ( list<A> const& xs, list<A> const& ys )
+{
+    auto x = xs._rep, y = ys._rep;
+    for ( ; x != y; x = x->_tail, y = y->_tail ) {
+        if ( x == list<A>::nil() || y == list<A>::nil() ) { return false; }
+        if ( !( list<A>::value( x ) == list<A>::value( y ) ) ) { return false; }
+    }
+    return true;
 }
 
 // Converting to and from strings
@@ -434,20 +476,16 @@ inline List<A> drop( unsigned k, List<A> const& xs )
  * @return a reference to the output stream
  */
 template <typename A>
-std::ostream& operator<< ( std::ostream& os, List<A> const& xs )
+std::ostream& operator<< ( std::ostream& os, list<A> const& xs )
 {
-  auto n = xs._rep;
-  if ( n ) {
-    os << '[' << n->_head;
-    while ( (n = n->_tail) ) {
-      os << ',' << n->_head;
+    os << '[';
+    for ( auto n = xs._rep; n != list<A>::nil(); n = n->_tail ) {
+        if ( n != xs._rep ) { os << ','; }
+        os << list<A>::value( n );
     }
-    os << ']';
-  }
-  return os;
+    return os << ']';
 }
 
-
 } // end namespace prelude
 
 #endif //HPP_PRELUDE_LIST
@@ -4,20 +4,18 @@
 
 using namespace prelude;
 
-std::string::size_type len(std::string const& s) { return s.length(); }
-
 int main(int argc, char** argv)
 {
-    std::cout << "List<int> requires " << sizeof(List<int>) << std::endl;
-    std::cout << "Node<int> requires " << sizeof(List<int>::Node) << std::endl;
+    std::cout << "list<int> requires " << sizeof(list<int>) << std::endl;
+    std::cout << "node<int> requires " << sizeof(_list_cons<int>) << std::endl;
 
     auto n = std::stoi(argv[1]);
     auto m = std::stof(argv[2]) + 1.f;
 
-    List<int> xs = cons( n, EMPTY<int> ); //n | EMPTY<int>;
+    list<int> xs { n };
     for (auto i = (n-1); i >= 1; --i) {
-        xs = cons( i, xs );
-        //xs = i | xs;
+        //xs = cons( i, xs );
+        xs = i | xs;
     }
 
     auto z = 0.f;
@@ -37,4 +35,3 @@ int main(int argc, char** argv)
 
     return 0;
 }
-
@@ -1,9 +1,10 @@
 #ifndef HPP_PRELUDE_LIST
 #define HPP_PRELUDE_LIST
 
-#include <memory>
 #include <functional>
 
+#include "../ListV10/Pool.hpp"
+
 /**
  * Implementation of Haskell-like, functional programming idioms, particularly recursive Lists.
  */
@@ -28,9 +29,9 @@ class List
  * @note required so that List can provide a distinct empty-list value
  */
 
-struct Node
+struct Node : public _counted
 {
-    using Ptr = std::shared_ptr<Node>;
+    using Ptr = shared_node<Node>;
 
     /**
      * Make an internal list node from an element and a pointer to a node.
@@ -42,6 +43,18 @@ struct Node
     Node( T && x, Ptr const& xs = nullptr ) : _datum(std::forward<T>(x)), _tail(xs) {}
     Node( T && x, Ptr &&     xs ) : _datum(std::forward<T>(x)), _tail(std::forward<Ptr>(xs)) {}
 
+    /**
+     * Unlinks solely-owned successors one at a time, so that dropping a long list
+     * does not recurse once per element through the tail's destructor.
+     */
+    ~Node()
+    {
+        while ( _tail && _tail.use_count() == 1 ) {
+            auto next = std::move( _tail->_tail );
+            _tail = std::move( next );
+        }
+    }
+
     /** The value of an element. */
     T _datum;
     /** Node containing the next element. */
@@ -59,14 +72,14 @@ public:
    * @note this constructor will never be called implicitly
    */
   explicit List( T const& x, List const& xs = EMPTY )
-    : _head( std::make_shared<Node>( x, xs._head ) ) {}
+    : _head( make_shared_node<Node>( x, xs._head ) ) {}
 
   /**
    * Make a list using standard universal initializer.
    */
   List( std::initializer_list<T> xs ) {
     for (auto i = xs.end(); i-- != xs.begin();) {
-      _head = std::make_shared<Node>(*i, _head);
+      _head = make_shared_node<Node>(*i, _head);
     }
   }
 
@@ -87,10 +100,10 @@ public:
 
 private:
   // pointer to internal node represenation
-  std::shared_ptr<Node> _head;
+  shared_node<Node> _head;
 
   // Permits implicit construction from pointer-to-Node (used internally & by friends)
-  List( std::shared_ptr<Node> xs = nullptr ) : _head( xs ) {}
+  List( shared_node<Node> xs = nullptr ) : _head( xs ) {}
 
   // Various friends allow for non-OOP functional-style
 
@@ -149,7 +162,7 @@ inline auto map( F f, List<U> const& xs ) -> List<decltype(f(head(xs)))>
     auto from = xs._head;
     auto to = ys._head;
     while ( (from = from->_tail) ) {
-        to = to->_tail = std::make_shared<Node>( f( from->_datum ) );
+        to = to->_tail = make_shared_node<Node>( f( from->_datum ) );
     }
     return ys;
 }
@@ -187,7 +200,7 @@ List<U> filter( P pred, List<U> const& xs )
   auto from = xs._head, to = ys._head;
   while ( from ) {
     if ( pred( from->_datum ) ) {
-      to = to->_tail = std::make_shared<Node>( from->_datum );
+      to = to->_tail = make_shared_node<Node>( from->_datum );
     }
     from = from->_tail;
   }
@@ -258,7 +271,7 @@ List<U> init( List<U> const& xs )
 
   auto to = ys._head;
   while ( (from = from->_tail) ) {
-    to = to->_tail = std::make_shared<Node>( from->_datum );
+    to = to->_tail = make_shared_node<Node>( from->_datum );
   }
   return ys;
 }
@@ -295,7 +308,7 @@ List<U> take( unsigned k, List<U> const& xs )
   auto ys = List<U>( from->_datum );
   auto to = ys._head;
   while ( --k > 0 && (from = from->_tail) ) {
-    to = to->_tail = std::make_shared<Node>( from->_datum );
+    to = to->_tail = make_shared_node<Node>( from->_datum );
   }
   return ys;
 }
@@ -3,6 +3,9 @@
 
 #include <memory>
 #include <functional>
+#include <ostream>
+
+#include "../ListV10/Pool.hpp"
 
 template <typename A> class Node;
 
@@ -19,14 +22,14 @@ template <typename A> class Node;
  * @version 1.0
  */
 template <typename A>
-using List = std::shared_ptr<Node<A>>;
+using List = prelude::shared_node<Node<A>>;
 
 /**
 * Internal node structure for a list.
 * @note required so that List can provide a distinct empty-list value
 */
 template <typename B>
-class Node
+class Node : public prelude::_counted
 {
   friend List<B>;
 public:
@@ -37,6 +40,17 @@ public:
    */
   Node(B x, List<B> const& xs) : _datum(x), _tail( xs ) {}
   Node(B x, List<B> && xs) : _datum(x), _tail( std::forward<List<B>>(xs) ) {}
+  /**
+   * Unlinks solely-owned successors one at a time, so that dropping a long list
+   * does not recurse once per element through the tail's destructor.
+   */
+  ~Node()
+  {
+    while ( _tail && _tail.use_count() == 1 ) {
+      auto next = std::move( _tail->_tail );
+      _tail = std::move( next );
+    }
+  }
 
 private:
   /** The value of an element. */
@@ -44,11 +58,21 @@ private:
   /** Node containing the next element. */
   List<B> _tail;
 
-  template <typename... Args> friend std::shared_ptr<Node> std::make_shared (Args&&...);
   template <typename A> friend bool    null( List<A> const& );
   template <typename A> friend A       head( List<A> const& );
   template <typename A> friend List<A> const& tail( List<A> const& );
   template <typename A> friend List<A> operator| ( A x, List<A> const& );
+  template <typename F, typename A> friend auto map( F f, List<A> const& xs ) -> List<decltype(f(head(xs)))>;
+  template <typename A> friend List<A> operator+ ( List<A> const&, List<A> const& );
+  template <typename P, typename A> friend List<A> filter( P, List<A> const& );
+  template <typename A> friend A       last( List<A> const& );
+  template <typename A> friend List<A> init( List<A> const& );
+  template <typename A> friend unsigned length( List<A> const& );
+  template <typename A> friend List<A> reverse( List<A> const& );
+  template <typename A> friend A       sum( List<A> const& );
+  template <typename A> friend List<A> take( unsigned, List<A> const& );
+  template <typename A> friend List<A> drop( unsigned, List<A> const& );
+  template <typename A> friend std::ostream& operator<< ( std::ostream&, List<A> const& );
 };
 
 /** Typed empty list constant - could implement as a method instead. */
@@ -62,7 +86,7 @@ List<A> EMPTY { nullptr };
  * @return a list with <var>x</var> at the head and <var>xs</var> as the tail
  */
 template <typename A>
-inline List<A> operator| ( A x, List<A> const& xs ) { return std::make_shared<Node<A>>( x, xs ); }
+inline List<A> operator| ( A x, List<A> const& xs ) { return prelude::make_shared_node<Node<A>>( x, xs ); }
 
 // List operations
 
@@ -76,8 +100,17 @@ inline List<A> operator| ( A x, List<A> const& xs ) { return std::make_shared<No
 template <typename F, typename A>
 inline auto map( F f, List<A> const& xs ) -> List<decltype(f(head(xs)))>
 {
-  if ( null( xs ) ) { return EMPTY<decltype(f(head(xs)))>; }
-  return f( head( xs ) ) | map<F,A>( f, tail( xs ) );
+  using B = decltype(f(head(xs)));
+
+  if ( null( xs ) ) { return EMPTY<B>; }
+
+  auto ys = prelude::make_shared_node<Node<B>>( f( xs->_datum ), EMPTY<B> );
+  auto to = ys.get();
+  for ( auto from = xs->_tail.get(); from; from = from->_tail.get() ) {
+    to->_tail = prelude::make_shared_node<Node<B>>( f( from->_datum ), EMPTY<B> );
+    to = to->_tail.get();
+  }
+  return ys;
 }
 
 /**
@@ -91,7 +124,15 @@ template <typename A>
 inline List<A> operator+ ( List<A> const& xs, List<A> const& ys )
 {
   if ( null( xs ) ) { return ys; }
-  return head( xs ) | tail( xs ) + ys;
+
+  auto zs = prelude::make_shared_node<Node<A>>( xs->_datum, EMPTY<A> );
+  auto to = zs.get();
+  for ( auto from = xs->_tail.get(); from; from = from->_tail.get() ) {
+    to->_tail = prelude::make_shared_node<Node<A>>( from->_datum, EMPTY<A> );
+    to = to->_tail.get();
+  }
+  to->_tail = ys;
+  return zs;
 }
 
 /**
@@ -103,10 +144,16 @@ inline List<A> operator+ ( List<A> const& xs, List<A> const& ys )
 template <typename P, typename A>
 inline List<A> filter( P pred, List<A> const& xs )
 {
-  if ( null( xs ) ) { return EMPTY<A>; }
-  auto ys = filter( pred, tail( xs ) );
-  auto x = head( xs );
-  return pred( x ) ? ( x | ys ) : ys;
+  List<A> ys;
+  Node<A>* to = nullptr;
+  for ( auto from = xs.get(); from; from = from->_tail.get() ) {
+    if ( !pred( from->_datum ) ) { continue; }
+    auto n = prelude::make_shared_node<Node<A>>( from->_datum, EMPTY<A> );
+    auto next = n.get();
+    if ( to ) { to->_tail = std::move( n ); } else { ys = std::move( n ); }
+    to = next;
+  }
+  return ys;
 }
 
 /**
@@ -131,12 +178,9 @@ inline A last( List<A> const& xs )
 {
   if ( null( xs ) ) { throw xs; }
 
-  auto ys = tail( xs );
-  if ( null( ys ) ) {
-    return head( xs );
-  } else {
-    return last( ys );
-  }
+  auto e = xs.get();
+  while ( e->_tail ) { e = e->_tail.get(); }
+  return e->_datum;
 }
 
 /**
@@ -160,13 +204,15 @@ template <typename A>
 inline List<A> init( List<A> const& xs )
 {
   if ( null( xs ) ) { throw xs; }
+  if ( !xs->_tail ) { return EMPTY<A>; }
 
-  auto ys = tail( xs );
-  if ( null( ys ) ) {
-    return ys;
-  } else {
-    return head( xs ) | init( ys );
+  auto ys = prelude::make_shared_node<Node<A>>( xs->_datum, EMPTY<A> );
+  auto to = ys.get();
+  for ( auto from = xs->_tail.get(); from->_tail; from = from->_tail.get() ) {
+    to->_tail = prelude::make_shared_node<Node<A>>( from->_datum, EMPTY<A> );
+    to = to->_tail.get();
   }
+  return ys;
 }
 
 /**
@@ -186,11 +232,9 @@ inline bool null( List<A> const& xs ) { return !xs; }
 template <typename A>
 inline unsigned length( List<A> const& xs )
 {
-  if ( null( xs ) ) {
-    return 0;
-  } else {
-    return 1 + length( tail( xs ) );
-  }
+  unsigned n = 0;
+  for ( auto e = xs.get(); e; e = e->_tail.get() ) { ++n; }
+  return n;
 }
 
 /**
@@ -201,12 +245,9 @@ inline unsigned length( List<A> const& xs )
 template <typename A>
 inline List<A> reverse( List<A> const& xs )
 {
-  std::function<List<A>(List<A>, List<A>)> rev;
-  rev = [&rev](List<A> const& xs, List<A> ys)->List<A>{
-    if ( null( xs ) ) { return ys; }
-    return rev( tail( xs ), head( xs ) | ys );
-  };
-  return rev( xs, EMPTY<A> );
+  auto ys = EMPTY<A>;
+  for ( auto e = xs.get(); e; e = e->_tail.get() ) { ys = e->_datum | ys; }
+  return ys;
 }
 
 // Special folds
@@ -220,8 +261,9 @@ inline List<A> reverse( List<A> const& xs )
 template <typename A>
 inline A sum( List<A> const& xs )
 {
-  if ( null( xs ) ) { return 0; }
-  return head( xs ) + sum( tail( xs ) );
+  A result = 0;
+  for ( auto e = xs.get(); e; e = e->_tail.get() ) { result += e->_datum; }
+  return result;
 }
 
 // Sublists
@@ -238,7 +280,13 @@ inline List<A> take( unsigned k, List<A> const& xs )
 {
   if ( k == 0 || null( xs ) ) { return EMPTY<A>; }
 
-  return head( xs ) | take( k - 1, tail( xs ) );
+  auto ys = prelude::make_shared_node<Node<A>>( xs->_datum, EMPTY<A> );
+  auto to = ys.get();
+  for ( auto from = xs->_tail.get(); --k > 0 && from; from = from->_tail.get() ) {
+    to->_tail = prelude::make_shared_node<Node<A>>( from->_datum, EMPTY<A> );
+    to = to->_tail.get();
+  }
+  return ys;
 }
 
 /**
@@ -251,9 +299,9 @@ inline List<A> take( unsigned k, List<A> const& xs )
 template <typename A>
 inline List<A> drop( unsigned k, List<A> const& xs )
 {
-  if ( k == 0 || null( xs ) ) { return xs; }
-
-  return drop( k - 1, tail( xs ) );
+  auto ys = xs;
+  while ( k-- > 0 && ys ) { ys = ys->_tail; }
+  return ys;
 }
 
 // Converting to and from strings
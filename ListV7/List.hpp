@@ -5,6 +5,8 @@
 #include <functional>
 #include <memory>
 
+#include "../ListV10/Pool.hpp"
+
 /**
  * Implementation of Haskell-like, functional programming idioms, particularly recursive Lists.
  */
@@ -22,7 +24,7 @@ template <typename A> class Node;
  * @version 1.0
  */
 template <typename A>
-using List = std::shared_ptr<Node<A>>;
+using List = shared_node<Node<A>>;
 
 /** Typed empty list constant - could implement as a method instead. */
 template <typename A>
@@ -33,7 +35,7 @@ List<A> const EMPTY { nullptr };
  * @note required so that List can provide a distinct empty-list value
  */
 template <typename B>
-class Node
+class Node : public _counted
 {
     friend List<B>;
 public:
@@ -42,7 +44,18 @@ public:
      * @param x  an element
      * @param xs pointer to an existing node (or nullptr)
      */
-    Node( B x, List<B> xs = EMPTY<B> ) : _datum( x ), _tail( xs ) {}
+    Node( B x, List<B> xs = EMPTY<B> ) : _datum( x ), _tail( std::move( xs ) ) {}
+    /**
+     * Unlinks solely-owned successors one at a time, so that dropping a long list
+     * does not recurse once per element through the tail's destructor.
+     */
+    ~Node()
+    {
+        while ( _tail && _tail.use_count() == 1 ) {
+            auto next = std::move( _tail->_tail );
+            _tail = std::move( next );
+        }
+    }
 
 private:
     /** The value of an element. */
@@ -50,13 +63,20 @@ private:
     /** Node containing the next element. */
     List<B> _tail;
 
-    friend std::shared_ptr<Node>& std::shared_ptr<Node>::operator= (std::shared_ptr<Node> const&) noexcept;
-    template <typename... Args> friend std::shared_ptr<Node> std::make_shared (Args&&...);
     template <typename A> friend bool    null( List<A> );
     template <typename A> friend A       head( List<A> );
     template <typename A> friend List<A> tail( List<A> );
     template <typename A> friend List<A> operator| ( A, List<A> );
     template <typename F, typename A> friend auto map( F f, List<A> xs ) -> List<decltype( f( head( xs ) ) )>;
+    template <typename A> friend List<A> operator+ ( List<A>, List<A> );
+    template <typename P, typename A> friend List<A> filter( P, List<A> );
+    template <typename A> friend A       last( List<A> );
+    template <typename A> friend List<A> init( List<A> );
+    template <typename A> friend unsigned length( List<A> );
+    template <typename A> friend List<A> reverse( List<A> );
+    template <typename A> friend A       sum( List<A> );
+    template <typename A> friend List<A> take( unsigned, List<A> );
+    template <typename A> friend List<A> drop( unsigned, List<A> );
     template <typename A> friend std::ostream& operator<< ( std::ostream& os, List<A> xs );
 };
 
@@ -67,7 +87,7 @@ private:
  * @return a list with <var>x</var> at the head and <var>xs</var> as the tail
  */
 template <typename A>
-inline List<A> operator| ( A x, List<A> xs ) { return std::make_shared<Node<A>>( x, xs ); }
+inline List<A> operator| ( A x, List<A> xs ) { return make_shared_node<Node<A>>( x, std::move( xs ) ); }
 
 // List operations
 
@@ -85,11 +105,12 @@ inline auto map( F f, List<A> xs ) -> List<decltype( f( head( xs ) ) )>
 
   	if ( null( xs ) ) return EMPTY<B>;
 
-  	auto ys = std::make_shared<Node<B>>( f( head( xs ) ), EMPTY<B> );
-  	auto from = xs;
-  	auto to = ys;
-  	while ( (from = from->_tail) ) {
-    	to = to->_tail = std::make_shared<Node<B>>( f( from->_datum ), EMPTY<B> );
+  	auto ys = make_shared_node<Node<B>>( f( head( xs ) ) );
+  	auto from = xs.get();
+  	auto to = ys.get();
+  	while ( (from = from->_tail.get()) ) {
+    	to->_tail = make_shared_node<Node<B>>( f( from->_datum ) );
+    	to = to->_tail.get();
   	}
   	return ys;
 }
@@ -105,7 +126,15 @@ template <typename A>
 inline List<A> operator+ ( List<A> xs, List<A> ys )
 {
     if ( null( xs ) ) { return ys; }
-    return head( xs ) | tail( xs ) + ys;
+
+    auto zs = make_shared_node<Node<A>>( xs->_datum );
+    auto to = zs.get();
+    for ( auto from = xs->_tail.get(); from; from = from->_tail.get() ) {
+        to->_tail = make_shared_node<Node<A>>( from->_datum );
+        to = to->_tail.get();
+    }
+    to->_tail = std::move( ys );
+    return zs;
 }
 
 /**
@@ -117,10 +146,16 @@ inline List<A> operator+ ( List<A> xs, List<A> ys )
 template <typename P, typename A>
 inline List<A> filter( P pred, List<A> xs )
 {
-    if ( null( xs ) ) { return EMPTY<A>; }
-    auto ys = filter( pred, tail( xs ) );
-    auto x = head( xs );
-    return pred( x ) ? ( x | ys ) : ys;
+    List<A> ys;
+    Node<A>* to = nullptr;
+    for ( auto from = xs.get(); from; from = from->_tail.get() ) {
+        if ( !pred( from->_datum ) ) { continue; }
+        auto n = make_shared_node<Node<A>>( from->_datum );
+        auto next = n.get();
+        if ( to ) { to->_tail = std::move( n ); } else { ys = std::move( n ); }
+        to = next;
+    }
+    return ys;
 }
 
 /**
@@ -157,12 +192,9 @@ inline A last( List<A> xs )
 {
   	if ( null( xs ) ) { throw xs; }
 
-  	auto ys = tail( xs );
-  	if ( null( ys ) ) {
-    	return head( xs );
-  	} else {
-    	return last( ys );
-  	}
+  	auto e = xs.get();
+  	while ( e->_tail ) { e = e->_tail.get(); }
+  	return e->_datum;
 }
 
 /**
@@ -174,13 +206,15 @@ template <typename A>
 inline List<A> init( List<A> xs )
 {
   if ( null( xs ) ) { throw xs; }
+  if ( !xs->_tail ) { return EMPTY<A>; }
 
-  auto ys = tail( xs );
-  if ( null( ys ) ) {
-    return ys;
-  } else {
-    return head( xs ) | init( ys );
+  auto ys = make_shared_node<Node<A>>( xs->_datum );
+  auto to = ys.get();
+  for ( auto from = xs->_tail.get(); from->_tail; from = from->_tail.get() ) {
+    to->_tail = make_shared_node<Node<A>>( from->_datum );
+    to = to->_tail.get();
   }
+  return ys;
 }
 
 /**
@@ -200,11 +234,9 @@ inline bool null( List<A> xs ) { return !xs; }
 template <typename A>
 inline unsigned length( List<A> xs )
 {
-  if ( null( xs ) ) {
-    return 0;
-  } else {
-    return 1 + length( tail( xs ) );
-  }
+  unsigned n = 0;
+  for ( auto e = xs.get(); e; e = e->_tail.get() ) { ++n; }
+  return n;
 }
 
 /**
@@ -215,12 +247,9 @@ inline unsigned length( List<A> xs )
 template <typename A>
 inline List<A> reverse( List<A> xs )
 {
-  std::function<List<A>(List<A>, List<A>)> rev;
-  rev = [&rev](List<A> xs, List<A> ys)->List<A>{
-    if ( null( xs ) ) { return ys; }
-    return rev( tail( xs ), head( xs ) | ys );
-  };
-  return rev( xs, EMPTY<A> );
+  auto ys = EMPTY<A>;
+  for ( auto e = xs.get(); e; e = e->_tail.get() ) { ys = e->_datum | std::move( ys ); }
+  return ys;
 }
 
 // Special folds
@@ -234,8 +263,9 @@ inline List<A> reverse( List<A> xs )
 template <typename A>
 inline A sum( List<A> xs )
 {
-  if ( null( xs ) ) { return 0; }
-  return head( xs ) + sum( tail( xs ) );
+  A result = 0;
+  for ( auto e = xs.get(); e; e = e->_tail.get() ) { result += e->_datum; }
+  return result;
 }
 
 // Sublists
@@ -252,7 +282,13 @@ inline List<A> take( unsigned k, List<A> xs )
 {
   if ( k == 0 || null( xs ) ) { return EMPTY<A>; }
 
-  return head( xs ) | take( k - 1, tail( xs ) );
+  auto ys = make_shared_node<Node<A>>( xs->_datum );
+  auto to = ys.get();
+  for ( auto from = xs->_tail.get(); --k > 0 && from; from = from->_tail.get() ) {
+    to->_tail = make_shared_node<Node<A>>( from->_datum );
+    to = to->_tail.get();
+  }
+  return ys;
 }
 
 /**
@@ -265,9 +301,8 @@ inline List<A> take( unsigned k, List<A> xs )
 template <typename A>
 inline List<A> drop( unsigned k, List<A> xs )
 {
-  if ( k == 0 || null( xs ) ) { return xs; }
-
-  return drop( k - 1, tail( xs ) );
+  while ( k-- > 0 && xs ) { xs = xs->_tail; }
+  return xs;
 }
 
 // Converting to and from strings
@@ -2,7 +2,7 @@
 ###
 
 NBEG=0
-NEND=9
+NEND=11
 
 NSIZE=${1:-10000}
 
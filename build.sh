@@ -2,7 +2,7 @@
 ###
 
 NBEG=0
-NEND=9
+NEND=11
 
 for i in $(seq $NBEG $NEND)
 do
@@ -11,8 +11,8 @@ do
     then
         cd $NEXTDIR
         echo "$NEXTDIR:"
-        g++ -O3 -std=c++14 -pedantic-errors -o TestList-gnu TestList.cpp
-        clang++ -O3 -std=c++14 -stdlib=libc++ -pedantic-errors -o TestList-clang TestList.cpp
+        g++ -O3 -std=c++17 -pedantic-errors -o TestList-gnu TestList.cpp
+        clang++ -O3 -std=c++17 -stdlib=libc++ -pedantic-errors -o TestList-clang TestList.cpp
         echo
         cd ..
     fi